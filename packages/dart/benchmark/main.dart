@@ -0,0 +1,107 @@
+import 'dart:io';
+
+import 'src/capture_benchmarks.dart';
+import 'src/client_report_benchmarks.dart';
+import 'src/harness.dart';
+import 'src/rate_limiter_benchmarks.dart';
+import 'src/scope_benchmarks.dart';
+import 'src/serialization_benchmarks.dart';
+import 'src/stack_trace_benchmarks.dart';
+import 'src/telemetry_benchmarks.dart';
+
+const _usage = '''
+Runs the benchmarks of the core SDK hot paths.
+
+Usage: dart run benchmark/main.dart [options]
+
+  --filter=<regex>       Only run benchmarks whose name matches.
+  --duration=<ms>        Measuring time per benchmark (default: 1000).
+  --json=<path>          Write the results as JSON to <path>.
+  --baseline=<path>      Compare with the results in <path> and exit with a
+                         non-zero code if a benchmark regressed.
+  --tolerance=<ratio>    Allowed slowdown against the baseline
+                         (default: 0.25, i.e. 25%).
+  --update-baseline      Write the results to the --baseline path instead of
+                         comparing with it.
+  --report-only          Print the regressions against the baseline but exit
+                         with 0, e.g. on shared CI runners whose timings are
+                         too noisy to fail a build on.
+''';
+
+Future<void> main(List<String> args) async {
+  final options = <String, String>{};
+  for (final arg in args) {
+    if (arg == '-h' || arg == '--help') {
+      stdout.write(_usage);
+      return;
+    }
+    final match = RegExp(r'^--([\w-]+)(?:=(.*))?$').firstMatch(arg);
+    if (match == null) {
+      stderr.write('Unknown argument: $arg\n\n$_usage');
+      exit(64);
+    }
+    options[match.group(1)!] = match.group(2) ?? '';
+  }
+
+  final filter = options['filter'];
+  final filterRegExp =
+      filter == null ? null : RegExp(filter, caseSensitive: false);
+  final duration =
+      Duration(milliseconds: int.parse(options['duration'] ?? '1000'));
+  final tolerance = double.parse(options['tolerance'] ?? '0.25');
+  final baselinePath = options['baseline'];
+  final jsonPath = options['json'];
+  final updateBaseline = options.containsKey('update-baseline');
+  final reportOnly = options.containsKey('report-only');
+
+  final benchmarks = [
+    ...captureBenchmarks,
+    ...serializationBenchmarks,
+    ...scopeBenchmarks,
+    ...telemetryBenchmarks,
+    ...stackTraceBenchmarks,
+    ...rateLimiterBenchmarks,
+    ...clientReportBenchmarks,
+  ].where((benchmark) => filterRegExp?.hasMatch(benchmark.name) ?? true);
+
+  final results = <BenchmarkResult>[];
+  for (final benchmark in benchmarks) {
+    final result = await runBenchmark(benchmark, duration: duration);
+    stdout.writeln('${result.name}: '
+        '${result.microsPerOp.toStringAsFixed(3)}us/op '
+        '(${result.iterations} iterations)');
+    results.add(result);
+  }
+
+  final json = resultsToJson(results);
+  if (jsonPath != null) {
+    await writeJson(jsonPath, json);
+  }
+
+  if (baselinePath == null) {
+    exit(0);
+  }
+  if (updateBaseline) {
+    await writeJson(baselinePath, json);
+    stdout.writeln('Baseline written to $baselinePath');
+    exit(0);
+  }
+
+  final baseline = await readJson(baselinePath);
+  if (baseline == null) {
+    stdout.writeln('No baseline at $baselinePath, skipping comparison. '
+        'Create one with --update-baseline.');
+    exit(0);
+  }
+  final regressions = findRegressions(results, baseline, tolerance: tolerance);
+  if (regressions.isNotEmpty) {
+    stderr.writeln('\n${regressions.length} benchmark(s) regressed by more '
+        'than ${(tolerance * 100).toStringAsFixed(0)}%: '
+        '${regressions.join(', ')}');
+    if (!reportOnly) {
+      exit(1);
+    }
+  }
+  // Pending timers of the SDK would keep the process alive otherwise.
+  exit(0);
+}
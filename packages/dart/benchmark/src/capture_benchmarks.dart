@@ -0,0 +1,23 @@
+import 'package:sentry/sentry.dart';
+
+import 'fixtures.dart';
+import 'harness.dart';
+
+final captureBenchmarks = [
+  Benchmark('capture/captureMessage', () {
+    final hub = Hub(benchmarkOptions());
+    return () => hub.captureMessage('benchmark');
+  }),
+  Benchmark('capture/captureException', () {
+    final hub = Hub(benchmarkOptions());
+    final stackTrace = StackTrace.current;
+    return () => hub.captureException(
+          StateError('benchmark'),
+          stackTrace: stackTrace,
+        );
+  }),
+  Benchmark('capture/captureEvent with beforeSend', () {
+    final hub = Hub(benchmarkOptions()..beforeSend = (event, hint) => event);
+    return () => hub.captureEvent(SentryEvent(message: SentryMessage('x')));
+  }),
+];
@@ -0,0 +1,27 @@
+import 'package:sentry/src/client_reports/client_report_recorder.dart';
+import 'package:sentry/src/client_reports/discard_reason.dart';
+import 'package:sentry/src/transport/data_category.dart';
+
+import 'harness.dart';
+
+final clientReportBenchmarks = [
+  Benchmark('client reports/record lost event', () {
+    final recorder = ClientReportRecorder(DateTime.now);
+    return () => recorder.recordLostEvent(
+          DiscardReason.queueOverflow,
+          DataCategory.span,
+        );
+  }),
+  Benchmark('client reports/record and flush 10 outcomes', () {
+    final recorder = ClientReportRecorder(DateTime.now);
+    return () {
+      for (var i = 0; i < 10; i++) {
+        recorder.recordLostEvent(
+          DiscardReason.values[i],
+          DataCategory.error,
+        );
+      }
+      recorder.flush();
+    };
+  }),
+];
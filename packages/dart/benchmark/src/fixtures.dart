@@ -0,0 +1,52 @@
+import 'package:sentry/sentry.dart';
+
+const benchmarkDsn = 'https://abc@def.ingest.sentry.io/1234567';
+
+SentryOptions benchmarkOptions() => SentryOptions(dsn: benchmarkDsn)
+  ..release = 'benchmark@1.0.0+1'
+  ..environment = 'benchmark'
+  ..transport = NullTransport();
+
+/// Accepts every envelope without encoding or sending it.
+class NullTransport implements Transport {
+  @override
+  Future<SentryId?> send(SentryEnvelope envelope) async =>
+      envelope.header.eventId;
+}
+
+/// An event with the data a typical error event carries.
+SentryEvent richEvent() {
+  final event = SentryEvent(
+    message: SentryMessage('Something went wrong: %s', params: ['details']),
+    level: SentryLevel.error,
+    tags: {for (var i = 0; i < 10; i++) 'tag$i': 'value$i'},
+    breadcrumbs: [
+      for (var i = 0; i < 100; i++)
+        Breadcrumb(
+          message: 'breadcrumb $i',
+          category: 'navigation',
+          data: {'from': '/page/$i', 'to': '/page/${i + 1}'},
+        ),
+    ],
+    user: SentryUser(id: '42', email: 'user@example.com'),
+    exceptions: [
+      SentryException(
+        type: 'StateError',
+        value: 'Bad state: benchmark',
+        stackTrace: SentryStackTrace(frames: [
+          for (var i = 0; i < 30; i++)
+            SentryStackFrame(
+              absPath: 'package:app/src/file_$i.dart',
+              function: 'function$i',
+              lineNo: i,
+              colNo: 7,
+              inApp: i.isEven,
+            ),
+        ]),
+      ),
+    ],
+  );
+  event.contexts.device = SentryDevice(model: 'benchmark', memorySize: 1024);
+  event.contexts.operatingSystem = SentryOperatingSystem(name: 'linux');
+  return event;
+}
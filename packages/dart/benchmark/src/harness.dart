@@ -0,0 +1,136 @@
+import 'dart:async';
+import 'dart:convert';
+import 'dart:io';
+
+/// A single benchmark. [setUp] runs once and returns the operation that is
+/// measured, so that fixtures are not part of the measurement.
+class Benchmark {
+  final String name;
+  final FutureOr<void> Function() Function() setUp;
+
+  const Benchmark(this.name, this.setUp);
+}
+
+class BenchmarkResult {
+  final String name;
+  final double microsPerOp;
+  final int iterations;
+
+  BenchmarkResult(this.name, this.microsPerOp, this.iterations);
+
+  Map<String, dynamic> toJson() => {
+        'us_per_op': double.parse(microsPerOp.toStringAsFixed(4)),
+        'iterations': iterations,
+      };
+}
+
+/// Runs [benchmark] for a warm-up period and then for at least [duration],
+/// and returns the average time per operation.
+Future<BenchmarkResult> runBenchmark(
+  Benchmark benchmark, {
+  required Duration duration,
+}) async {
+  final op = benchmark.setUp();
+
+  // Warm up, so the measured code is optimized by the JIT.
+  await _runFor(op, duration ~/ 5);
+
+  final (iterations, elapsed) = await _runFor(op, duration);
+  return BenchmarkResult(
+    benchmark.name,
+    elapsed.inMicroseconds / iterations,
+    iterations,
+  );
+}
+
+Future<(int, Duration)> _runFor(
+  FutureOr<void> Function() op,
+  Duration duration,
+) async {
+  final stopwatch = Stopwatch()..start();
+  var iterations = 0;
+  // Check the clock only every few iterations, fast operations would
+  // otherwise mostly measure the stopwatch.
+  var batch = 1;
+  while (stopwatch.elapsed < duration) {
+    for (var i = 0; i < batch; i++) {
+      final result = op();
+      if (result is Future) {
+        await result;
+      }
+    }
+    iterations += batch;
+    if (batch < 1024) {
+      batch *= 2;
+    }
+  }
+  return (iterations, stopwatch.elapsed);
+}
+
+Map<String, dynamic> resultsToJson(List<BenchmarkResult> results) => {
+      'dart': Platform.version,
+      'os': Platform.operatingSystem,
+      'benchmarks': {
+        for (final result in results) result.name: result.toJson(),
+      },
+    };
+
+/// Compares [results] with the `us_per_op` values of [baseline] and returns
+/// the names of the benchmarks that got slower by more than [tolerance],
+/// e.g. `0.25` for 25%.
+List<String> findRegressions(
+  List<BenchmarkResult> results,
+  Map<String, dynamic> baseline, {
+  required double tolerance,
+}) {
+  final baselineBenchmarks =
+      (baseline['benchmarks'] as Map?)?.cast<String, dynamic>() ?? const {};
+  final regressions = <String>[];
+
+  stdout.writeln();
+  stdout.writeln('${'Benchmark'.padRight(48)}'
+      '${'baseline'.padLeft(12)}'
+      '${'current'.padLeft(12)}'
+      '${'change'.padLeft(10)}');
+  for (final result in results) {
+    final expected = (baselineBenchmarks[result.name] as Map?)?['us_per_op'];
+    if (expected is! num || expected <= 0) {
+      stdout.writeln('${result.name.padRight(48)}${'-'.padLeft(12)}'
+          '${_formatMicros(result.microsPerOp).padLeft(12)}');
+      continue;
+    }
+    final change = result.microsPerOp / expected - 1;
+    final regressed = change > tolerance;
+    if (regressed) {
+      regressions.add(result.name);
+    }
+    final percent = '${change >= 0 ? '+' : ''}'
+        '${(change * 100).toStringAsFixed(1)}%';
+    stdout.writeln('${result.name.padRight(48)}'
+        '${_formatMicros(expected.toDouble()).padLeft(12)}'
+        '${_formatMicros(result.microsPerOp).padLeft(12)}'
+        '${percent.padLeft(10)}'
+        '${regressed ? '  REGRESSION' : ''}');
+  }
+  return regressions;
+}
+
+String _formatMicros(double micros) => micros >= 1000
+    ? '${(micros / 1000).toStringAsFixed(2)}ms'
+    : '${micros.toStringAsFixed(3)}us';
+
+Future<Map<String, dynamic>?> readJson(String path) async {
+  final file = File(path);
+  if (!await file.exists()) {
+    return null;
+  }
+  return jsonDecode(await file.readAsString()) as Map<String, dynamic>;
+}
+
+Future<void> writeJson(String path, Map<String, dynamic> json) async {
+  final file = File(path);
+  await file.parent.create(recursive: true);
+  await file.writeAsString(
+    '${const JsonEncoder.withIndent('  ').convert(json)}\n',
+  );
+}
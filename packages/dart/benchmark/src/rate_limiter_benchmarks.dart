@@ -0,0 +1,37 @@
+import 'package:sentry/sentry.dart';
+import 'package:sentry/src/sentry_envelope_header.dart';
+import 'package:sentry/src/transport/rate_limiter.dart';
+
+import 'fixtures.dart';
+import 'harness.dart';
+
+final rateLimiterBenchmarks = [
+  Benchmark('rate limiter/filter (not limited)', () {
+    final options = benchmarkOptions();
+    final rateLimiter = RateLimiter(options);
+    final envelope = SentryEnvelope.fromEvent(SentryEvent(), options.sdk);
+    return () => rateLimiter.filter(envelope);
+  }),
+  Benchmark('rate limiter/filter (other category limited)', () {
+    final options = benchmarkOptions();
+    final rateLimiter = RateLimiter(options)
+      ..updateRetryAfterLimits('60:transaction:key', null, 429);
+    final envelope = SentryEnvelope.fromEvent(SentryEvent(), options.sdk);
+    return () => rateLimiter.filter(envelope);
+  }),
+  Benchmark('rate limiter/filter (one of ten items limited)', () {
+    final options = benchmarkOptions();
+    final rateLimiter = RateLimiter(options)
+      ..updateRetryAfterLimits('60:attachment:key', null, 429);
+    final envelope = SentryEnvelope(
+      SentryEnvelopeHeader.newEventId(),
+      [
+        for (var i = 0; i < 9; i++) SentryEnvelopeItem.fromEvent(SentryEvent()),
+        SentryEnvelopeItem.fromAttachment(
+          SentryAttachment.fromIntList([0], 'attachment.bin'),
+        ),
+      ],
+    );
+    return () => rateLimiter.filter(envelope);
+  }),
+];
@@ -0,0 +1,27 @@
+import 'package:sentry/sentry.dart';
+
+import 'fixtures.dart';
+import 'harness.dart';
+
+final scopeBenchmarks = [
+  Benchmark('scope/clone', () {
+    final scope = Scope(benchmarkOptions());
+    for (var i = 0; i < 100; i++) {
+      scope.addBreadcrumb(Breadcrumb(message: 'breadcrumb $i'));
+    }
+    for (var i = 0; i < 10; i++) {
+      scope.setTag('tag$i', 'value$i');
+    }
+    scope.setUser(SentryUser(id: '42'));
+    return () => scope.clone();
+  }),
+  Benchmark('scope/addBreadcrumb', () {
+    // Full, so every added breadcrumb also evicts the oldest one.
+    final scope = Scope(benchmarkOptions());
+    for (var i = 0; i < 100; i++) {
+      scope.addBreadcrumb(Breadcrumb(message: 'breadcrumb $i'));
+    }
+    final breadcrumb = Breadcrumb(message: 'breadcrumb', category: 'ui');
+    return () => scope.addBreadcrumb(breadcrumb);
+  }),
+];
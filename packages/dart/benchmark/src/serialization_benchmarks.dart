@@ -0,0 +1,21 @@
+import 'package:sentry/sentry.dart';
+
+import 'fixtures.dart';
+import 'harness.dart';
+
+final serializationBenchmarks = [
+  Benchmark('serialization/SentryEvent.toJson', () {
+    final event = richEvent();
+    return () => event.toJson();
+  }),
+  Benchmark('serialization/envelopeStream', () {
+    final options = benchmarkOptions();
+    final envelope = SentryEnvelope.fromEvent(richEvent(), options.sdk);
+    return () => envelope.envelopeStream(options).drain<void>();
+  }),
+  Benchmark('serialization/snapshot.encode', () {
+    final options = benchmarkOptions();
+    final envelope = SentryEnvelope.fromEvent(richEvent(), options.sdk);
+    return () async => (await envelope.snapshot(options)).encode();
+  }),
+];
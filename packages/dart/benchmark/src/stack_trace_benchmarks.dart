@@ -0,0 +1,15 @@
+import 'package:sentry/src/sentry_stack_trace_factory.dart';
+
+import 'fixtures.dart';
+import 'harness.dart';
+
+final stackTraceBenchmarks = [
+  Benchmark('stack trace/parse', () {
+    final factory = SentryStackTraceFactory(benchmarkOptions());
+    final stackTrace = _deepStackTrace(30);
+    return () => factory.parse(stackTrace);
+  }),
+];
+
+StackTrace _deepStackTrace(int depth) =>
+    depth == 0 ? StackTrace.current : _deepStackTrace(depth - 1);
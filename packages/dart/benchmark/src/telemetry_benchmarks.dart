@@ -0,0 +1,44 @@
+import 'package:sentry/sentry.dart';
+import 'package:sentry/src/telemetry/processing/buffer_config.dart';
+import 'package:sentry/src/telemetry/processing/in_memory_buffer.dart';
+
+import 'harness.dart';
+
+final telemetryBenchmarks = [
+  Benchmark('telemetry/log buffer add', () {
+    final buffer = InMemoryTelemetryBuffer<SentryLog>(
+      encoder: (log) => log.toJsonBytes(),
+      onFlush: (_) {},
+    );
+    final log = _log();
+    // Every 100th add flushes, as the buffer is full then.
+    return () => buffer.add(log);
+  }),
+  Benchmark('telemetry/log buffer add 100 + flush', () {
+    final buffer = InMemoryTelemetryBuffer<SentryLog>(
+      encoder: (log) => log.toJsonBytes(),
+      onFlush: (_) {},
+      config: const TelemetryBufferConfig(maxItemCount: 1000),
+    );
+    final log = _log();
+    return () {
+      for (var i = 0; i < 100; i++) {
+        buffer.add(log);
+      }
+      return buffer.flush();
+    };
+  }),
+];
+
+SentryLog _log() => SentryLog(
+      timestamp: DateTime.utc(2025),
+      traceId: SentryId.newId(),
+      level: SentryLogLevel.info,
+      body: 'User 42 opened the settings page',
+      attributes: {
+        'sentry.sdk.name': SentryAttribute.string('sentry.dart'),
+        'sentry.environment': SentryAttribute.string('benchmark'),
+        'user.id': SentryAttribute.string('42'),
+        'count': SentryAttribute.int(3),
+      },
+    );
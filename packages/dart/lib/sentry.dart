@@ -38,6 +38,8 @@ export 'src/sentry_baggage.dart';
 // ignore: invalid_export_of_internal_element
 export 'src/sentry_client.dart';
 // ignore: invalid_export_of_internal_element
+export 'src/memory_pressure/memory_governor.dart';
+// ignore: invalid_export_of_internal_element
 export 'src/sdk_lifecycle_hooks.dart';
 export 'src/sentry_envelope.dart';
 export 'src/sentry_envelope_item.dart';
@@ -69,3 +71,5 @@ export 'src/utils/breadcrumb_log_level.dart';
 export 'src/telemetry/telemetry.dart';
 // ignore: invalid_export_of_internal_element
 export 'src/utils/internal_logger.dart' show SentryInternalLogger;
+export 'src/utils/sdk_overhead_stats.dart'
+    show SdkOverheadStage, SdkOverheadStats, SdkOverheadStageStats;
@@ -11,13 +11,21 @@ class ClientReportRecorder {
   ClientReportRecorder(this._clock);
 
   final ClockProvider _clock;
-  final Map<_QuantityKey, int> _quantities = {};
+
+  /// Lost quantities, one per reason and category, see [_indexOf].
+  final List<int> _quantities = List<int>.filled(
+    DiscardReason.values.length * DataCategory.values.length,
+    0,
+  );
+  bool _isEmpty = true;
+
+  static int _indexOf(DiscardReason reason, DataCategory category) =>
+      reason.index * DataCategory.values.length + category.index;
 
   void recordLostEvent(final DiscardReason reason, final DataCategory category,
       {int count = 1}) {
-    final key = _QuantityKey(reason, category);
-    var current = _quantities[key] ?? 0;
-    _quantities[key] = current + count;
+    _quantities[_indexOf(reason, category)] += count;
+    _isEmpty = false;
   }
 
   /// Records a dropped log as a [DataCategory.logItem] count and, when the
@@ -48,35 +56,26 @@ class ClientReportRecorder {
   }
 
   ClientReport? flush() {
-    if (_quantities.isEmpty) {
+    if (_isEmpty) {
       return null;
     }
 
-    final events = _quantities.keys.map((key) {
-      final quantity = _quantities[key] ?? 0;
-      return DiscardedEvent(key.reason, key.category, quantity);
-    }).toList(growable: false);
-
-    _quantities.clear();
+    final events = <DiscardedEvent>[];
+    for (final reason in DiscardReason.values) {
+      for (final category in DataCategory.values) {
+        final index = _indexOf(reason, category);
+        final quantity = _quantities[index];
+        if (quantity != 0) {
+          events.add(DiscardedEvent(reason, category, quantity));
+          _quantities[index] = 0;
+        }
+      }
+    }
+    _isEmpty = true;
+    if (events.isEmpty) {
+      return null;
+    }
 
     return ClientReport(_clock(), events);
   }
 }
-
-class _QuantityKey {
-  _QuantityKey(this.reason, this.category);
-
-  final DiscardReason reason;
-  final DataCategory category;
-
-  @override
-  int get hashCode => Object.hash(reason.hashCode, category.hashCode);
-
-  @override
-  // ignore: non_nullable_equals_parameter
-  bool operator ==(dynamic other) {
-    return other is _QuantityKey &&
-        other.reason == reason &&
-        other.category == category;
-  }
-}
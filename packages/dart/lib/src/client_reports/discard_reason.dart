@@ -15,4 +15,5 @@ enum DiscardReason {
   internalSdkError,
   ignored,
   sendError,
+  backpressure,
 }
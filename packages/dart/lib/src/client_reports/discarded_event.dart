@@ -45,6 +45,8 @@ extension _OutcomeExtension on DiscardReason {
         return 'ignored';
       case DiscardReason.sendError:
         return 'send_error';
+      case DiscardReason.backpressure:
+        return 'backpressure';
     }
   }
 }
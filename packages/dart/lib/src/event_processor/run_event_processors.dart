@@ -1,3 +1,5 @@
+import 'dart:async';
+
 import 'package:meta/meta.dart';
 
 import '../client_reports/discard_reason.dart';
@@ -9,65 +11,128 @@ import '../protocol/sentry_transaction.dart';
 import '../sentry_options.dart';
 import '../transport/data_category.dart';
 
+/// Runs [eventProcessors] on [event].
+///
+/// Processors run synchronously until one of them returns a [Future]; only
+/// from then on the remaining processors are awaited. If no processor is
+/// async, the result is returned synchronously.
 @internal
-Future<SentryEvent?> runEventProcessors(
+FutureOr<SentryEvent?> runEventProcessors(
   SentryEvent event,
   Hint hint,
   List<EventProcessor> eventProcessors,
   SentryOptions options,
-) async {
-  int spanCountBeforeEventProcessors =
+) {
+  final spanCountBeforeEventProcessors =
       event is SentryTransaction ? event.spans.length : 0;
 
   SentryEvent? processedEvent = event;
-  for (final processor in eventProcessors) {
+  for (var i = 0; i < eventProcessors.length; i++) {
+    try {
+      final e = eventProcessors[i].apply(processedEvent!, hint);
+      if (e is Future<SentryEvent?>) {
+        return _runEventProcessorsAsync(event, hint, eventProcessors, options,
+            i, e, processedEvent, spanCountBeforeEventProcessors);
+      }
+      processedEvent = e;
+    } catch (exception, stackTrace) {
+      _logProcessorError(options, exception, stackTrace);
+    }
+
+    if (!_recordProcessed(
+        event, processedEvent, spanCountBeforeEventProcessors, options)) {
+      break;
+    }
+  }
+
+  return processedEvent;
+}
+
+/// Continues [runEventProcessors] once the processor at [index] returned
+/// [pending].
+Future<SentryEvent?> _runEventProcessorsAsync(
+  SentryEvent event,
+  Hint hint,
+  List<EventProcessor> eventProcessors,
+  SentryOptions options,
+  int index,
+  Future<SentryEvent?> pending,
+  SentryEvent? processedEvent,
+  int spanCountBeforeEventProcessors,
+) async {
+  for (var i = index; i < eventProcessors.length; i++) {
     try {
-      final e = processor.apply(processedEvent!, hint);
+      final e = i == index
+          ? pending
+          : eventProcessors[i].apply(processedEvent!, hint);
       processedEvent = e is Future<SentryEvent?> ? await e : e;
     } catch (exception, stackTrace) {
-      options.log(
-        SentryLevel.error,
-        'An exception occurred while processing event by a processor',
-        exception: exception,
-        stackTrace: stackTrace,
-      );
-      if (options.automatedTestMode) {
-        rethrow;
-      }
+      _logProcessorError(options, exception, stackTrace);
     }
 
-    final discardReason = DiscardReason.eventProcessor;
-    if (processedEvent == null) {
-      options.recorder.recordLostEvent(discardReason, _getCategory(event));
-      if (event is SentryTransaction) {
-        // We dropped the whole transaction, the dropped count includes all child spans + 1 root span
-        options.recorder.recordLostEvent(
-          discardReason,
-          DataCategory.span,
-          count: spanCountBeforeEventProcessors + 1,
-        );
-      }
-      options.log(SentryLevel.debug, 'Event was dropped by a processor');
+    if (!_recordProcessed(
+        event, processedEvent, spanCountBeforeEventProcessors, options)) {
       break;
-    } else if (event is SentryTransaction &&
-        processedEvent is SentryTransaction) {
-      // If event processor removed only some spans we still report them as dropped
-      final spanCountAfterEventProcessors = processedEvent.spans.length;
-      final droppedSpanCount =
-          spanCountBeforeEventProcessors - spanCountAfterEventProcessors;
-      if (droppedSpanCount > 0) {
-        options.recorder.recordLostEvent(
-          discardReason,
-          DataCategory.span,
-          count: droppedSpanCount,
-        );
-      }
     }
   }
 
   return processedEvent;
 }
 
+void _logProcessorError(
+  SentryOptions options,
+  Object exception,
+  StackTrace stackTrace,
+) {
+  options.log(
+    SentryLevel.error,
+    'An exception occurred while processing event by a processor',
+    exception: exception,
+    stackTrace: stackTrace,
+  );
+  if (options.automatedTestMode) {
+    Error.throwWithStackTrace(exception, stackTrace);
+  }
+}
+
+/// Records what a processor dropped. Returns `false` if the whole event was
+/// dropped and no further processors should run.
+bool _recordProcessed(
+  SentryEvent event,
+  SentryEvent? processedEvent,
+  int spanCountBeforeEventProcessors,
+  SentryOptions options,
+) {
+  final discardReason = DiscardReason.eventProcessor;
+  if (processedEvent == null) {
+    options.recorder.recordLostEvent(discardReason, _getCategory(event));
+    if (event is SentryTransaction) {
+      // We dropped the whole transaction, the dropped count includes all child spans + 1 root span
+      options.recorder.recordLostEvent(
+        discardReason,
+        DataCategory.span,
+        count: spanCountBeforeEventProcessors + 1,
+      );
+    }
+    options.log(SentryLevel.debug, 'Event was dropped by a processor');
+    return false;
+  } else if (event is SentryTransaction &&
+      processedEvent is SentryTransaction) {
+    // If event processor removed only some spans we still report them as dropped
+    final spanCountAfterEventProcessors = processedEvent.spans.length;
+    final droppedSpanCount =
+        spanCountBeforeEventProcessors - spanCountAfterEventProcessors;
+    if (droppedSpanCount > 0) {
+      options.recorder.recordLostEvent(
+        discardReason,
+        DataCategory.span,
+        count: droppedSpanCount,
+      );
+    }
+  }
+  return true;
+}
+
 DataCategory _getCategory(SentryEvent event) {
   if (event is SentryTransaction) {
     return DataCategory.transaction;
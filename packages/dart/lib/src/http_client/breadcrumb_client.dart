@@ -1,3 +1,5 @@
+import 'dart:async';
+
 import 'package:http/http.dart';
 import 'package:meta/meta.dart';
 
@@ -70,6 +72,7 @@ class BreadcrumbClient extends BaseClient {
     int? responseBodySize;
     Map<String, dynamic>? requestDetail;
     Map<String, dynamic>? responseDetail;
+    Future<void>? responseBodyCaptured;
     DateTime? responseTimestamp;
 
     final stopwatch = Stopwatch();
@@ -117,6 +120,7 @@ class BreadcrumbClient extends BaseClient {
         final result = await capture.captureResponse(response);
         response = result.$1;
         responseDetail = result.$2;
+        responseBodyCaptured = result.$3;
       }
 
       return response;
@@ -160,8 +164,29 @@ class BreadcrumbClient extends BaseClient {
         breadcrumb.data?['response'] = responseDetail;
       }
 
-      await _hub.addBreadcrumb(breadcrumb);
+      if (responseBodyCaptured != null) {
+        // The response body is captured while the caller reads it, and the
+        // breadcrumb is serialized as soon as it is added, so adding it has
+        // to wait until the body is done.
+        unawaited(_addBreadcrumbWithBody(breadcrumb, responseBodyCaptured));
+      } else {
+        await _hub.addBreadcrumb(breadcrumb);
+      }
+    }
+  }
+
+  /// Adds [breadcrumb] once [bodyCaptured] completes, which is bound to the
+  /// response stream, or without the body if it can't be captured.
+  Future<void> _addBreadcrumbWithBody(
+    Breadcrumb breadcrumb,
+    Future<void> bodyCaptured,
+  ) async {
+    try {
+      await bodyCaptured;
+    } catch (_) {
+      // The breadcrumb is still added, without the body.
     }
+    await _hub.addBreadcrumb(breadcrumb);
   }
 
   @override
@@ -15,9 +15,13 @@ abstract class NetworkDetailsCapture {
   Map<String, dynamic> captureRequest(BaseRequest request);
 
   /// Returns the response to forward to the original caller (its body
-  /// stream may need to be replaced after being consumed for capture) and
-  /// the captured detail to attach to the replay breadcrumb.
-  Future<(StreamedResponse, Map<String, dynamic>)> captureResponse(
+  /// stream may be replaced to capture the body while the caller reads it),
+  /// the captured detail to attach to the replay breadcrumb, and, if the
+  /// body is captured, a future that completes once the caller is done
+  /// reading it, stops reading it or doesn't start reading it right away.
+  /// The detail is only complete after that future completes.
+  Future<(StreamedResponse, Map<String, dynamic>, Future<void>?)>
+      captureResponse(
     StreamedResponse response,
   );
 }
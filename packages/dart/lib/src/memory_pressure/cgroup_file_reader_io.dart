@@ -0,0 +1,10 @@
+import 'dart:io';
+
+/// Reads a cgroup file, returns null if it doesn't exist or can't be read.
+Future<String?> readCgroupFile(String path) async {
+  try {
+    return await File(path).readAsString();
+  } on FileSystemException {
+    return null;
+  }
+}
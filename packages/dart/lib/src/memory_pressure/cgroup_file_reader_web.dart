@@ -0,0 +1,2 @@
+/// There are no cgroups in the browser.
+Future<String?> readCgroupFile(String path) async => null;
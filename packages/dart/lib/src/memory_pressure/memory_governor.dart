@@ -0,0 +1,125 @@
+import 'dart:async';
+import 'dart:math';
+
+import 'package:meta/meta.dart';
+
+import '../protocol/sentry_level.dart';
+import '../sdk_lifecycle_hooks.dart';
+import '../sentry_options.dart';
+import '../telemetry/log/log.dart';
+import '../telemetry/log/log_level.dart';
+
+/// How tight memory is, and so how much the SDK sheds. Every level includes
+/// the measures of the levels below.
+@internal
+enum MemoryPressureLevel {
+  /// Nothing is shed.
+  normal,
+
+  /// Caches such as the breadcrumbs, the replay masks and the last replay
+  /// frame are shrunk.
+  moderate,
+
+  /// Telemetry buffers are flushed early and replays are recorded in a lower
+  /// quality.
+  high,
+
+  /// Low-priority telemetry, i.e. logs below [SentryLogLevel.warn], is
+  /// dropped.
+  critical;
+
+  bool isAtLeast(MemoryPressureLevel other) => index >= other.index;
+}
+
+/// Tracks the [MemoryPressureLevel] of the app and dispatches
+/// [OnMemoryPressure] when it changes, so that the parts of the SDK that hold
+/// on to memory can shed it.
+///
+/// Pressure sources only [report] elevated levels. The level goes down by
+/// itself, one step per [recoveryDelay] without a report of at least the
+/// current level, so sources which only signal that memory is tight, like
+/// the Flutter memory pressure callback, work the same as sources that
+/// measure it.
+@internal
+class MemoryGovernor {
+  MemoryGovernor(this._options);
+
+  /// Time without a report after which the level goes down by one step.
+  static const recoveryDelay = Duration(seconds: 30);
+
+  final SentryOptions _options;
+  var _level = MemoryPressureLevel.normal;
+  Timer? _recoveryTimer;
+
+  MemoryPressureLevel get level => _level;
+
+  /// Raises the level to [level]. Reports below the current level are
+  /// ignored, the level only goes down after [recoveryDelay].
+  void report(MemoryPressureLevel level) {
+    if (level == MemoryPressureLevel.normal || level.index < _level.index) {
+      return;
+    }
+    _recoveryTimer?.cancel();
+    _recoveryTimer = Timer(recoveryDelay, _recover);
+    _setLevel(level);
+  }
+
+  /// Raises the level by one step, at least to [minimum]. For signals that
+  /// say that memory is tight but not how tight, so that repeated signals
+  /// step the level up.
+  void escalate(MemoryPressureLevel minimum) {
+    final next = MemoryPressureLevel.values[
+        min(_level.index + 1, MemoryPressureLevel.critical.index)];
+    report(next.isAtLeast(minimum) ? next : minimum);
+  }
+
+  /// Returns how many of [maxCount] items a cache keeps at the current level:
+  /// all of them without pressure, half at [MemoryPressureLevel.moderate]
+  /// and half as many again per level above, but at least one.
+  int capacityOf(int maxCount) {
+    if (_level == MemoryPressureLevel.normal || maxCount == 0) {
+      return maxCount;
+    }
+    return max(1, maxCount >> _level.index);
+  }
+
+  /// Whether [log] is dropped because of the current level.
+  bool shouldDropLog(SentryLog log) =>
+      _level == MemoryPressureLevel.critical &&
+      (log.severityNumber ?? log.level.toSeverityNumber()) <
+          SentryLogLevel.warn.toSeverityNumber();
+
+  /// Stops the recovery and goes back to [MemoryPressureLevel.normal]
+  /// without dispatching [OnMemoryPressure].
+  void close() {
+    _recoveryTimer?.cancel();
+    _recoveryTimer = null;
+    _level = MemoryPressureLevel.normal;
+  }
+
+  void _recover() {
+    _recoveryTimer = null;
+    final lower = MemoryPressureLevel.values[_level.index - 1];
+    if (lower != MemoryPressureLevel.normal) {
+      _recoveryTimer = Timer(recoveryDelay, _recover);
+    }
+    _setLevel(lower);
+  }
+
+  void _setLevel(MemoryPressureLevel level) {
+    if (level == _level) {
+      return;
+    }
+    final previous = _level;
+    _level = level;
+    _options.log(
+      level.index > previous.index ? SentryLevel.warning : SentryLevel.info,
+      'Memory pressure changed from ${previous.name} to ${level.name}.',
+    );
+    final result = _options.lifecycleRegistry
+        .dispatchCallback(OnMemoryPressure(level, previous));
+    if (result is Future) {
+      unawaited(result);
+    }
+  }
+}
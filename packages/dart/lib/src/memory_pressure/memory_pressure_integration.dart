@@ -0,0 +1,87 @@
+import 'dart:async';
+
+import 'package:meta/meta.dart';
+
+import '../hub.dart';
+import '../integration.dart';
+import '../sdk_lifecycle_hooks.dart';
+import '../sentry_options.dart';
+import 'cgroup_file_reader_io.dart'
+    if (dart.library.js_interop) 'cgroup_file_reader_web.dart';
+import 'memory_governor.dart';
+import 'memory_pressure_source.dart';
+
+/// Reports the levels of the [SentryOptions.memoryPressureSources] and, with
+/// [SentryOptions.enableCgroupMemoryPressure] on Linux, of the cgroup of the
+/// process to the [SentryOptions.memoryGovernor], and sheds what the Dart
+/// SDK holds on to when the level goes up:
+/// - the scope breadcrumbs are cut down to
+///   [MemoryGovernor.capacityOf] [SentryOptions.maxBreadcrumbs],
+/// - the telemetry buffers are flushed when the level reaches
+///   [MemoryPressureLevel.high].
+///
+/// Dropping logs is up to the log pipeline, see
+/// [MemoryGovernor.shouldDropLog].
+@internal
+class MemoryPressureIntegration extends Integration<SentryOptions> {
+  static const integrationName = 'MemoryPressure';
+
+  final _subscriptions = <StreamSubscription<MemoryPressureLevel>>[];
+  CgroupMemoryPressureSource? _cgroupSource;
+  Hub? _hub;
+  SentryOptions? _options;
+
+  @override
+  void call(Hub hub, SentryOptions options) {
+    _hub = hub;
+    _options = options;
+    options.lifecycleRegistry
+        .registerCallback<OnMemoryPressure>(_onMemoryPressure);
+
+    final sources = [...options.memoryPressureSources];
+    if (options.enableCgroupMemoryPressure &&
+        options.platform.isLinux &&
+        !options.platform.isWeb) {
+      final cgroupSource = CgroupMemoryPressureSource(readCgroupFile);
+      _cgroupSource = cgroupSource;
+      sources.add(cgroupSource);
+    }
+    for (final source in sources) {
+      _subscriptions.add(source.levels.listen(options.memoryGovernor.report));
+    }
+
+    options.sdk.addIntegration(integrationName);
+  }
+
+  Future<void> _onMemoryPressure(OnMemoryPressure event) async {
+    final level = event.level;
+    final previous = event.previous;
+    if (!level.isAtLeast(previous)) {
+      // Caches grow back by themselves.
+      return;
+    }
+
+    await _hub?.configureScope((scope) => scope.trimBreadcrumbs());
+
+    if (level.isAtLeast(MemoryPressureLevel.high) &&
+        !previous.isAtLeast(MemoryPressureLevel.high)) {
+      await _options?.telemetryProcessor.flush();
+    }
+  }
+
+  @override
+  Future<void> close() async {
+    for (final subscription in _subscriptions) {
+      await subscription.cancel();
+    }
+    _subscriptions.clear();
+    await _cgroupSource?.close();
+    _cgroupSource = null;
+    final options = _options;
+    options?.lifecycleRegistry
+        .removeCallback<OnMemoryPressure>(_onMemoryPressure);
+    options?.memoryGovernor.close();
+    _options = null;
+    _hub = null;
+  }
+}
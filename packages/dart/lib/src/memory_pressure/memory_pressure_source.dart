@@ -0,0 +1,231 @@
+import 'dart:async';
+import 'dart:convert';
+
+import 'package:meta/meta.dart';
+
+import 'memory_governor.dart';
+
+/// Tells the [MemoryGovernor] when memory is tight.
+@internal
+abstract class MemoryPressureSource {
+  /// Elevated pressure levels, as they are observed.
+  Stream<MemoryPressureLevel> get levels;
+
+  FutureOr<void> close();
+}
+
+/// A [MemoryPressureSource] that reports the levels passed to [simulate].
+@internal
+class SimulatedMemoryPressureSource implements MemoryPressureSource {
+  final _controller = StreamController<MemoryPressureLevel>.broadcast(
+    sync: true,
+  );
+
+  @override
+  Stream<MemoryPressureLevel> get levels => _controller.stream;
+
+  void simulate(MemoryPressureLevel level) => _controller.add(level);
+
+  @override
+  Future<void> close() => _controller.close();
+}
+
+/// Reads a file, returns null if it can't be read.
+@internal
+typedef CgroupFileReader = Future<String?> Function(String path);
+
+/// A [MemoryPressureSource] that polls the cgroup v2 memory controller of the
+/// process on Linux.
+///
+/// Two files of the cgroup are read:
+/// - `memory.pressure`, the pressure stall information (PSI): the share of
+///   the last 10 seconds in which some or all tasks waited for memory.
+/// - `memory.events`, counters of how often the cgroup went over its `high`
+///   and `max` limits and ran out of memory. Only increments since the
+///   previous poll count.
+///
+/// Polling stops for good if neither file can be read, e.g. on cgroup v1.
+@internal
+class CgroupMemoryPressureSource implements MemoryPressureSource {
+  CgroupMemoryPressureSource(
+    this._readFile, {
+    this.pollInterval = const Duration(seconds: 5),
+  });
+
+  /// Share in percent of the last 10 seconds in which some tasks waited for
+  /// memory, from which on the level is [MemoryPressureLevel.moderate].
+  static const someModeratePercent = 10.0;
+
+  /// Like [someModeratePercent], for [MemoryPressureLevel.high].
+  static const someHighPercent = 30.0;
+
+  /// Share in percent of the last 10 seconds in which all tasks waited for
+  /// memory, from which on the level is [MemoryPressureLevel.critical].
+  static const fullCriticalPercent = 10.0;
+
+  final CgroupFileReader _readFile;
+  final Duration pollInterval;
+
+  late final _controller = StreamController<MemoryPressureLevel>(
+    onListen: _start,
+    onCancel: _stop,
+  );
+
+  Timer? _timer;
+  String? _directory;
+  Map<String, int>? _previousEvents;
+  var _polling = false;
+
+  @override
+  Stream<MemoryPressureLevel> get levels => _controller.stream;
+
+  Future<void> _start() async {
+    if (await poll() == null || !_controller.hasListener) {
+      return;
+    }
+    _timer = Timer.periodic(pollInterval, (_) => unawaited(poll()));
+  }
+
+  void _stop() {
+    _timer?.cancel();
+    _timer = null;
+  }
+
+  @override
+  Future<void> close() {
+    _stop();
+    return _controller.close();
+  }
+
+  /// Reads the cgroup files and adds the level to [levels] if it is above
+  /// [MemoryPressureLevel.normal]. Returns the level, or null if the files
+  /// can't be read.
+  @visibleForTesting
+  Future<MemoryPressureLevel?> poll() async {
+    if (_polling) {
+      // The previous poll is still reading the files.
+      return MemoryPressureLevel.normal;
+    }
+    _polling = true;
+    try {
+      final directory = _directory ??= await _resolveDirectory();
+      if (directory == null) {
+        return null;
+      }
+      final pressure = await _readFile('$directory/memory.pressure');
+      final events = await _readFile('$directory/memory.events');
+      if (pressure == null && events == null) {
+        _stop();
+        return null;
+      }
+
+      var level = MemoryPressureLevel.normal;
+      if (pressure != null) {
+        level = levelOfPressure(pressure);
+      }
+      if (events != null) {
+        final counters = parseEvents(events);
+        final previous = _previousEvents;
+        _previousEvents = counters;
+        if (previous != null) {
+          final fromEvents = levelOfEvents(previous, counters);
+          if (fromEvents.index > level.index) {
+            level = fromEvents;
+          }
+        }
+      }
+
+      if (level != MemoryPressureLevel.normal && !_controller.isClosed) {
+        _controller.add(level);
+      }
+      return level;
+    } finally {
+      _polling = false;
+    }
+  }
+
+  /// The cgroup v2 directory of the process, from the `0::<path>` line of
+  /// `/proc/self/cgroup`.
+  Future<String?> _resolveDirectory() async {
+    final content = await _readFile('/proc/self/cgroup');
+    if (content == null) {
+      return null;
+    }
+    for (final line in LineSplitter.split(content)) {
+      if (line.startsWith('0::')) {
+        final path = line.substring(3);
+        return path == '/' ? '/sys/fs/cgroup' : '/sys/fs/cgroup$path';
+      }
+    }
+    return null;
+  }
+
+  /// The level of the `avg10` values in the content of `memory.pressure`.
+  @visibleForTesting
+  static MemoryPressureLevel levelOfPressure(String content) {
+    var some = 0.0;
+    var full = 0.0;
+    for (final line in LineSplitter.split(content)) {
+      final fields = line.split(' ');
+      final avg10 = fields
+          .where((field) => field.startsWith('avg10='))
+          .map((field) => double.tryParse(field.substring(6)))
+          .firstOrNull;
+      if (avg10 == null) {
+        continue;
+      }
+      if (fields.first == 'some') {
+        some = avg10;
+      } else if (fields.first == 'full') {
+        full = avg10;
+      }
+    }
+
+    if (full >= fullCriticalPercent) {
+      return MemoryPressureLevel.critical;
+    }
+    if (some >= someHighPercent) {
+      return MemoryPressureLevel.high;
+    }
+    if (some >= someModeratePercent) {
+      return MemoryPressureLevel.moderate;
+    }
+    return MemoryPressureLevel.normal;
+  }
+
+  /// The counters in the content of `memory.events`.
+  @visibleForTesting
+  static Map<String, int> parseEvents(String content) {
+    final counters = <String, int>{};
+    for (final line in LineSplitter.split(content)) {
+      final fields = line.split(' ');
+      final value = fields.length == 2 ? int.tryParse(fields[1]) : null;
+      if (value != null) {
+        counters[fields[0]] = value;
+      }
+    }
+    return counters;
+  }
+
+  /// The level of the `memory.events` counters that went up from [previous]
+  /// to [current]: running out of memory is critical, hitting the `max`
+  /// limit is high and going over the `high` limit is moderate pressure.
+  @visibleForTesting
+  static MemoryPressureLevel levelOfEvents(
+    Map<String, int> previous,
+    Map<String, int> current,
+  ) {
+    bool increased(String key) => (current[key] ?? 0) > (previous[key] ?? 0);
+
+    if (increased('oom_kill') || increased('oom')) {
+      return MemoryPressureLevel.critical;
+    }
+    if (increased('max')) {
+      return MemoryPressureLevel.high;
+    }
+    if (increased('high')) {
+      return MemoryPressureLevel.moderate;
+    }
+    return MemoryPressureLevel.normal;
+  }
+}
@@ -1,39 +1,91 @@
 import 'package:meta/meta.dart';
-import 'package:uuid/uuid.dart';
+
+import '../utils/id_generator.dart';
 
 /// Hexadecimal string representing a uuid4 value.
 /// The length is exactly 32
 /// characters. Dashes are not allowed. Has to be lowercase.
+///
+/// The value is stored as four 32-bit words and only formatted as hex when
+/// [toString] is called, e.g. during serialization.
 @immutable
 class SentryId {
-  /// The ID Sentry.io assigned to the submitted event for future reference.
-  final String _id;
+  final int _w0;
+  final int _w1;
+  final int _w2;
+  final int _w3;
+
+  /// Set only if the ID given to [SentryId.fromId] is not a lowercase
+  /// 32 character hex string. Such IDs are kept verbatim.
+  final String? _raw;
 
-  static final Uuid _uuidGenerator = Uuid();
+  const SentryId._words(this._w0, this._w1, this._w2, this._w3)
+      : _raw = null;
 
-  SentryId._internal({String? id})
-      : _id =
-            id?.replaceAll('-', '') ?? _uuidGenerator.v4().replaceAll('-', '');
+  const SentryId._verbatim(String raw)
+      : _w0 = 0,
+        _w1 = 0,
+        _w2 = 0,
+        _w3 = 0,
+        _raw = raw;
 
   /// Generates a new SentryId
-  SentryId.newId() : this._internal();
+  SentryId.newId()
+      : this._words(
+          IdGenerator.nextNonZeroWord(),
+          IdGenerator.nextWord(),
+          IdGenerator.nextWord(),
+          IdGenerator.nextWord(),
+        );
 
   /// Generates a SentryId with the given UUID
-  SentryId.fromId(String id) : this._internal(id: id);
+  factory SentryId.fromId(String id) {
+    id = id.replaceAll('-', '');
+    if (id.length == 32) {
+      final w0 = IdGenerator.parseHexWord(id, 0);
+      final w1 = IdGenerator.parseHexWord(id, 8);
+      final w2 = IdGenerator.parseHexWord(id, 16);
+      final w3 = IdGenerator.parseHexWord(id, 24);
+      if (w0 != null && w1 != null && w2 != null && w3 != null) {
+        return SentryId._words(w0, w1, w2, w3);
+      }
+    }
+    return SentryId._verbatim(id);
+  }
 
   /// SentryId with an empty UUID
-  const SentryId.empty() : _id = '00000000000000000000000000000000';
+  const SentryId.empty()
+      : _w0 = 0,
+        _w1 = 0,
+        _w2 = 0,
+        _w3 = 0,
+        _raw = null;
 
   @override
-  String toString() => _id;
+  String toString() {
+    final raw = _raw;
+    if (raw != null) {
+      return raw;
+    }
+    final buffer = List<int>.filled(32, 0);
+    IdGenerator.writeHexWord(buffer, 0, _w0);
+    IdGenerator.writeHexWord(buffer, 8, _w1);
+    IdGenerator.writeHexWord(buffer, 16, _w2);
+    IdGenerator.writeHexWord(buffer, 24, _w3);
+    return String.fromCharCodes(buffer);
+  }
 
   @override
-  int get hashCode => _id.hashCode;
+  int get hashCode => _raw?.hashCode ?? Object.hash(_w0, _w1, _w2, _w3);
 
   @override
   bool operator ==(o) {
     if (o is SentryId) {
-      return o._id == _id;
+      return o._raw == _raw &&
+          o._w0 == _w0 &&
+          o._w1 == _w1 &&
+          o._w2 == _w2 &&
+          o._w3 == _w3;
     }
     return false;
   }
@@ -1,37 +1,70 @@
 import 'package:meta/meta.dart';
-import 'package:uuid/uuid.dart';
+
+import '../utils/id_generator.dart';
 
 /// The length is exactly 16 characters.
 /// Dashes are not allowed. Has to be lowercase.
+///
+/// The value is stored as two 32-bit words and only formatted as hex when
+/// [toString] is called, e.g. during serialization.
 @immutable
 class SpanId {
-  final String _id;
+  final int _high;
+  final int _low;
+
+  /// Set only if the ID given to [SpanId.fromId] is not a lowercase
+  /// 16 character hex string. Such IDs are kept verbatim.
+  final String? _raw;
 
-  static final Uuid _uuidGenerator = Uuid();
+  const SpanId._words(this._high, this._low) : _raw = null;
 
-  SpanId._internal({String? id})
-      : _id = id?.replaceAll('-', '') ??
-            _uuidGenerator.v4().replaceAll('-', '').substring(0, 16);
+  const SpanId._verbatim(String raw)
+      : _high = 0,
+        _low = 0,
+        _raw = raw;
 
   /// Generates a new SpanId
-  SpanId.newId() : this._internal();
+  SpanId.newId()
+      : this._words(IdGenerator.nextNonZeroWord(), IdGenerator.nextWord());
 
   /// Generates a SpanId with the given UUID
-  SpanId.fromId(String id) : this._internal(id: id);
+  factory SpanId.fromId(String id) {
+    id = id.replaceAll('-', '');
+    if (id.length == 16) {
+      final high = IdGenerator.parseHexWord(id, 0);
+      final low = IdGenerator.parseHexWord(id, 8);
+      if (high != null && low != null) {
+        return SpanId._words(high, low);
+      }
+    }
+    return SpanId._verbatim(id);
+  }
 
   /// SpanId with an empty UUID
-  const SpanId.empty() : _id = '0000000000000000';
+  const SpanId.empty()
+      : _high = 0,
+        _low = 0,
+        _raw = null;
 
   @override
-  String toString() => _id;
+  String toString() {
+    final raw = _raw;
+    if (raw != null) {
+      return raw;
+    }
+    final buffer = List<int>.filled(16, 0);
+    IdGenerator.writeHexWord(buffer, 0, _high);
+    IdGenerator.writeHexWord(buffer, 8, _low);
+    return String.fromCharCodes(buffer);
+  }
 
   @override
-  int get hashCode => _id.hashCode;
+  int get hashCode => _raw?.hashCode ?? Object.hash(_high, _low);
 
   @override
   bool operator ==(o) {
     if (o is SpanId) {
-      return o._id == _id;
+      return o._raw == _raw && o._high == _high && o._low == _low;
     }
     return false;
   }
@@ -6,6 +6,7 @@ import 'package:meta/meta.dart';
 import 'event_processor.dart';
 import 'event_processor/run_event_processors.dart';
 import 'hint.dart';
+import 'memory_pressure/memory_governor.dart';
 import 'propagation_context.dart';
 import 'protocol.dart';
 import 'scope_observer.dart';
@@ -238,16 +239,28 @@ class Scope {
       }
     }
     if (processedBreadcrumb != null) {
-      // remove first item if list is full
-      if (_breadcrumbs.length >= _options.maxBreadcrumbs &&
-          _breadcrumbs.isNotEmpty) {
-        _breadcrumbs.removeFirst();
-      }
+      // remove the first items if the list is full, it holds fewer items
+      // under memory pressure
+      _trimBreadcrumbsTo(_breadcrumbCapacity - 1);
       _breadcrumbs.add(processedBreadcrumb);
     }
     return processedBreadcrumb;
   }
 
+  int get _breadcrumbCapacity =>
+      _options.memoryGovernor.capacityOf(_options.maxBreadcrumbs);
+
+  void _trimBreadcrumbsTo(int count) {
+    while (_breadcrumbs.length > count) {
+      _breadcrumbs.removeFirst();
+    }
+  }
+
+  /// Drops the oldest breadcrumbs the scope can't keep at the current
+  /// [MemoryGovernor.level].
+  @internal
+  void trimBreadcrumbs() => _trimBreadcrumbsTo(_breadcrumbCapacity);
+
   /// Adds a breadcrumb to the breadcrumbs queue
   Future<void> addBreadcrumb(Breadcrumb breadcrumb, {Hint? hint}) async {
     final addedBreadcrumb = _addBreadCrumbSync(breadcrumb, hint ?? Hint());
@@ -357,6 +370,17 @@ class Scope {
     SentryEvent event,
     Hint hint,
   ) async {
+    final result = applyToEventInternal(event, hint);
+    return result is Future<SentryEvent?> ? await result : result;
+  }
+
+  /// Same as [applyToEvent], but completes synchronously unless one of the
+  /// scope's event processors is async.
+  @internal
+  FutureOr<SentryEvent?> applyToEventInternal(
+    SentryEvent event,
+    Hint hint,
+  ) {
     event
       ..transaction = event.transaction ?? transaction
       ..user = _mergeUsers(user, event.user)
@@ -403,7 +427,7 @@ class Scope {
       }
     }
 
-    return await runEventProcessors(event, hint, _eventProcessors, _options);
+    return runEventProcessors(event, hint, _eventProcessors, _options);
   }
 
   /// Merge the scope contexts runtimes and the event contexts runtimes.
@@ -141,3 +141,24 @@ class OnGenerateNewTrace extends SdkLifecycleEvent {
 
   OnGenerateNewTrace(this.traceId, this.spanId);
 }
+
+/// Dispatched when the [MemoryGovernor] level changes from [previous] to
+/// [level].
+@internal
+class OnMemoryPressure extends SdkLifecycleEvent {
+  final MemoryPressureLevel level;
+  final MemoryPressureLevel previous;
+
+  OnMemoryPressure(this.level, this.previous);
+}
+
+/// Dispatched when the app navigates from the route named [from] to the
+/// route named [to], e.g. by the `SentryNavigatorObserver` of
+/// `sentry_flutter`.
+@internal
+class OnNavigation extends SdkLifecycleEvent {
+  final String? from;
+  final String? to;
+
+  OnNavigation({this.from, this.to});
+}
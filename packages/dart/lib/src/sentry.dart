@@ -15,6 +15,7 @@ import 'hub.dart';
 import 'hub_adapter.dart';
 import 'integration.dart';
 import 'load_dart_debug_images_integration.dart';
+import 'memory_pressure/memory_pressure_integration.dart';
 import 'noop_hub.dart';
 import 'noop_isolate_error_integration.dart'
     if (dart.library.io) 'isolate_error_integration.dart';
@@ -123,6 +124,7 @@ class Sentry {
     options.addIntegration(InstrumentationSpanFactorySetupIntegration());
     options.addIntegration(FeatureFlagsIntegration());
     options.addIntegration(InMemoryTelemetryProcessorIntegration());
+    options.addIntegration(MemoryPressureIntegration());
     options.addIntegration(TrackBeforeSendUsageIntegration());
 
     final platformContextProvider = PlatformContextProvider(options);
@@ -32,6 +32,7 @@ import 'transport/spotlight_http_transport.dart';
 import 'type_check_hint.dart';
 import 'utils/isolate_utils.dart';
 import 'utils/regex_utils.dart';
+import 'utils/sdk_overhead_stats.dart';
 import 'utils/stacktrace_utils.dart';
 import 'version.dart';
 
@@ -145,8 +146,11 @@ class SentryClient {
     SentryEvent? preparedEvent =
         _prepareEvent(event, hint, stackTrace: stackTrace);
 
+    // Only await where a step actually returned a future, so that events
+    // without async processors or callbacks are processed synchronously.
     if (scope != null) {
-      preparedEvent = await scope.applyToEvent(preparedEvent, hint);
+      final scoped = scope.applyToEventInternal(preparedEvent, hint);
+      preparedEvent = scoped is Future<SentryEvent?> ? await scoped : scoped;
     } else {
       _options.log(
           SentryLevel.debug, 'No scope to apply on event was provided');
@@ -157,12 +161,17 @@ class SentryClient {
       return _emptySentryId;
     }
 
-    preparedEvent = await runEventProcessors(
+    final processorsTimer =
+        _options.sdkOverheadStats.start(SdkOverheadStage.eventProcessors);
+    final processed = runEventProcessors(
       preparedEvent,
       hint,
       _options.eventProcessors,
       _options,
     );
+    preparedEvent =
+        processed is Future<SentryEvent?> ? await processed : processed;
+    processorsTimer?.stop();
 
     // dropped by event processors
     if (preparedEvent == null) {
@@ -171,10 +180,13 @@ class SentryClient {
 
     preparedEvent = _createUserOrSetDefaultIpAddress(preparedEvent);
 
-    preparedEvent = await _runBeforeSend(
-      preparedEvent,
-      hint,
-    );
+    final beforeSendTimer =
+        _options.sdkOverheadStats.start(SdkOverheadStage.beforeSend);
+    final beforeSendResult = _runBeforeSend(preparedEvent, hint);
+    preparedEvent = beforeSendResult is Future<SentryEvent?>
+        ? await beforeSendResult
+        : beforeSendResult;
+    beforeSendTimer?.stop();
 
     // dropped by beforeSend
     if (preparedEvent == null) {
@@ -182,8 +194,11 @@ class SentryClient {
     }
 
     // Event is fully processed and ready to be sent
-    await _options.lifecycleRegistry
+    final dispatch = _options.lifecycleRegistry
         .dispatchCallback(OnBeforeSendEvent(preparedEvent, hint));
+    if (dispatch is Future) {
+      await dispatch;
+    }
 
     var attachments = List<SentryAttachment>.from(scope?.attachments ?? []);
     attachments.addAll(hint.attachments);
@@ -407,8 +422,10 @@ class SentryClient {
         _prepareEvent(transaction, hint) as SentryTransaction;
 
     if (scope != null) {
-      preparedTransaction = await scope.applyToEvent(preparedTransaction, hint)
-          as SentryTransaction?;
+      final scoped = scope.applyToEventInternal(preparedTransaction, hint);
+      preparedTransaction =
+          (scoped is Future<SentryEvent?> ? await scoped : scoped)
+              as SentryTransaction?;
     } else {
       _options.log(
           SentryLevel.debug, 'No scope to apply on transaction was provided');
@@ -419,12 +436,18 @@ class SentryClient {
       return _emptySentryId;
     }
 
-    preparedTransaction = await runEventProcessors(
+    final processorsTimer =
+        _options.sdkOverheadStats.start(SdkOverheadStage.eventProcessors);
+    final processed = runEventProcessors(
       preparedTransaction,
       hint,
       _options.eventProcessors,
       _options,
-    ) as SentryTransaction?;
+    );
+    preparedTransaction =
+        (processed is Future<SentryEvent?> ? await processed : processed)
+            as SentryTransaction?;
+    processorsTimer?.stop();
 
     // dropped by event processors
     if (preparedTransaction == null) {
@@ -445,8 +468,13 @@ class SentryClient {
     preparedTransaction = _createUserOrSetDefaultIpAddress(preparedTransaction)
         as SentryTransaction;
 
-    preparedTransaction =
-        await _runBeforeSend(preparedTransaction, hint) as SentryTransaction?;
+    final beforeSendTimer =
+        _options.sdkOverheadStats.start(SdkOverheadStage.beforeSend);
+    final beforeSendResult = _runBeforeSend(preparedTransaction, hint);
+    preparedTransaction = (beforeSendResult is Future<SentryEvent?>
+        ? await beforeSendResult
+        : beforeSendResult) as SentryTransaction?;
+    beforeSendTimer?.stop();
 
     // dropped by beforeSendTransaction
     if (preparedTransaction == null) {
@@ -521,18 +549,23 @@ class SentryClient {
       _metricCapturePipeline.captureMetric(metric, scope: scope);
 
   FutureOr<void> close() {
+    _spanCapturePipeline.close();
     final flush = _options.telemetryProcessor.flush();
     if (flush is Future<void>) {
-      return flush.then((_) => _options.httpClient.close());
+      return flush.then((_) => _closeTransportResources());
     }
+    _closeTransportResources();
+  }
+
+  void _closeTransportResources() {
     _options.httpClient.close();
+    unawaited(_options.workerPool.close());
   }
 
-  Future<SentryEvent?> _runBeforeSend(
+  FutureOr<SentryEvent?> _runBeforeSend(
     SentryEvent event,
     Hint hint,
-  ) async {
-    SentryEvent? processedEvent = event;
+  ) {
     final spanCountBeforeCallback =
         event is SentryTransaction ? event.spans.length : 0;
 
@@ -541,42 +574,66 @@ class SentryClient {
     final beforeSendFeedback = _options.beforeSendFeedback;
     String beforeSendName = 'beforeSend';
 
+    FutureOr<SentryEvent?> callbackResult = event;
     try {
       if (event is SentryTransaction && beforeSendTransaction != null) {
         beforeSendName = 'beforeSendTransaction';
-        final callbackResult = beforeSendTransaction(event, hint);
-        if (callbackResult is Future<SentryTransaction?>) {
-          processedEvent = await callbackResult;
-        } else {
-          processedEvent = callbackResult;
-        }
+        callbackResult = beforeSendTransaction(event, hint);
       } else if (event.type == 'feedback' && beforeSendFeedback != null) {
-        final callbackResult = beforeSendFeedback(event, hint);
-        if (callbackResult is Future<SentryEvent?>) {
-          processedEvent = await callbackResult;
-        } else {
-          processedEvent = callbackResult;
-        }
+        callbackResult = beforeSendFeedback(event, hint);
       } else if (beforeSend != null) {
-        final callbackResult = beforeSend(event, hint);
-        if (callbackResult is Future<SentryEvent?>) {
-          processedEvent = await callbackResult;
-        } else {
-          processedEvent = callbackResult;
-        }
+        callbackResult = beforeSend(event, hint);
       }
     } catch (exception, stackTrace) {
-      _options.log(
-        SentryLevel.error,
-        'The $beforeSendName callback threw an exception',
-        exception: exception,
-        stackTrace: stackTrace,
-      );
-      if (_options.automatedTestMode) {
-        rethrow;
-      }
+      _logBeforeSendError(beforeSendName, exception, stackTrace);
     }
 
+    if (callbackResult is Future<SentryEvent?>) {
+      return _awaitBeforeSend(
+          event, callbackResult, beforeSendName, spanCountBeforeCallback);
+    }
+    return _recordBeforeSend(
+        event, callbackResult, beforeSendName, spanCountBeforeCallback);
+  }
+
+  Future<SentryEvent?> _awaitBeforeSend(
+    SentryEvent event,
+    Future<SentryEvent?> callbackResult,
+    String beforeSendName,
+    int spanCountBeforeCallback,
+  ) async {
+    SentryEvent? processedEvent = event;
+    try {
+      processedEvent = await callbackResult;
+    } catch (exception, stackTrace) {
+      _logBeforeSendError(beforeSendName, exception, stackTrace);
+    }
+    return _recordBeforeSend(
+        event, processedEvent, beforeSendName, spanCountBeforeCallback);
+  }
+
+  void _logBeforeSendError(
+    String beforeSendName,
+    Object exception,
+    StackTrace stackTrace,
+  ) {
+    _options.log(
+      SentryLevel.error,
+      'The $beforeSendName callback threw an exception',
+      exception: exception,
+      stackTrace: stackTrace,
+    );
+    if (_options.automatedTestMode) {
+      Error.throwWithStackTrace(exception, stackTrace);
+    }
+  }
+
+  SentryEvent? _recordBeforeSend(
+    SentryEvent event,
+    SentryEvent? processedEvent,
+    String beforeSendName,
+    int spanCountBeforeCallback,
+  ) {
     final discardReason = DiscardReason.beforeSend;
     if (processedEvent == null) {
       _options.recorder.recordLostEvent(discardReason, _getCategory(event));
@@ -10,6 +10,7 @@ import 'sentry_item_type.dart';
 import 'sentry_options.dart';
 import 'sentry_trace_context_header.dart';
 import 'utils.dart';
+import 'utils/sdk_overhead_stats.dart';
 import 'package:meta/meta.dart';
 
 /// Class representation of `Envelope` file.
@@ -156,9 +157,13 @@ class SentryEnvelope {
 
     final newLineData = utf8.encode('\n');
     for (final item in items) {
+      final List<int> data;
+      final List<int> itemHeader;
+      final timer =
+          options.sdkOverheadStats.start(SdkOverheadStage.serialization);
       try {
         final dataFuture = item.dataFactory();
-        final data = dataFuture is Future ? await dataFuture : dataFuture;
+        data = dataFuture is Future ? await dataFuture : dataFuture;
 
         // Only attachments should be filtered according to
         // SentryOptions.maxAttachmentSize
@@ -167,18 +172,70 @@ class SentryEnvelope {
           continue;
         }
 
-        yield newLineData;
-        yield utf8JsonEncoder.convert(await item.header.toJson(data.length));
-        yield newLineData;
-        yield data;
+        itemHeader =
+            utf8JsonEncoder.convert(await item.header.toJson(data.length));
       } catch (_) {
         if (options.automatedTestMode) {
           rethrow;
         }
         // Skip throwing envelope item data closure.
         continue;
+      } finally {
+        timer?.stop();
+      }
+
+      yield newLineData;
+      yield itemHeader;
+      yield newLineData;
+      yield data;
+    }
+  }
+
+  /// Captures this envelope as a [SentryEnvelopeSnapshot], which can be
+  /// encoded on another isolate.
+  ///
+  /// JSON items are captured as their JSON maps, other items as their bytes.
+  /// Items are skipped and filtered like in [envelopeStream], so encoding the
+  /// snapshot yields the same bytes.
+  @internal
+  Future<SentryEnvelopeSnapshot> snapshot(SentryOptions options) async {
+    final timer =
+        options.sdkOverheadStats.start(SdkOverheadStage.serialization);
+    try {
+      return await _snapshot(options);
+    } finally {
+      timer?.stop();
+    }
+  }
+
+  Future<SentryEnvelopeSnapshot> _snapshot(SentryOptions options) async {
+    final snapshotItems =
+        <(Map<String, dynamic> header, List<int>? data, Object? json)>[];
+    for (final item in items) {
+      try {
+        final jsonFactory = item.jsonFactory;
+        if (jsonFactory != null) {
+          final headerJson = await item.header.toJson(0)
+            ..remove('length');
+          snapshotItems.add((headerJson, null, jsonFactory()));
+          continue;
+        }
+
+        final dataFuture = item.dataFactory();
+        final data = dataFuture is Future ? await dataFuture : dataFuture;
+        if (item.header.type == SentryItemType.attachment &&
+            data.length > options.maxAttachmentSize) {
+          continue;
+        }
+        snapshotItems.add((await item.header.toJson(data.length), data, null));
+      } catch (_) {
+        if (options.automatedTestMode) {
+          rethrow;
+        }
+        continue;
       }
     }
+    return SentryEnvelopeSnapshot(header.toJson(), snapshotItems);
   }
 
   /// Builds the top-level metadata shared by telemetry envelope item payloads.
@@ -251,3 +308,36 @@ class SentryEnvelope {
     }
   }
 }
+
+/// The data of a [SentryEnvelope], detached from the objects it was created
+/// from, see [SentryEnvelope.snapshot].
+@internal
+class SentryEnvelopeSnapshot {
+  SentryEnvelopeSnapshot(this.header, this.items);
+
+  final Map<String, dynamic> header;
+
+  /// The item headers with either the encoded item data or the JSON to
+  /// encode. Headers of JSON items do not contain the `length` yet.
+  final List<(Map<String, dynamic> header, List<int>? data, Object? json)>
+      items;
+
+  /// Encodes the envelope, producing the same bytes as
+  /// [SentryEnvelope.envelopeStream].
+  Uint8List encode() {
+    final builder = BytesBuilder(copy: false);
+    final newLineData = utf8.encode('\n');
+    builder.add(utf8JsonEncoder.convert(header));
+    for (final (itemHeader, encoded, json) in items) {
+      final data = encoded ?? utf8JsonEncoder.convert(json);
+      if (encoded == null) {
+        itemHeader['length'] = data.length;
+      }
+      builder.add(newLineData);
+      builder.add(utf8JsonEncoder.convert(itemHeader));
+      builder.add(newLineData);
+      builder.add(data);
+    }
+    return builder.takeBytes();
+  }
+}
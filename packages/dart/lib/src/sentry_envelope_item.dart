@@ -13,7 +13,12 @@ class SentryEnvelopeItem {
   /// The original, non-encoded object, used when direct access to the source data is needed.
   Object? originalObject;
 
-  SentryEnvelopeItem(this.header, this.dataFactory, {this.originalObject});
+  SentryEnvelopeItem(
+    this.header,
+    this.dataFactory, {
+    this.originalObject,
+    this.jsonFactory,
+  });
 
   /// Creates a [SentryEnvelopeItem] which sends [SentryTransaction].
   factory SentryEnvelopeItem.fromTransaction(SentryTransaction transaction) {
@@ -23,7 +28,7 @@ class SentryEnvelopeItem {
     );
     return SentryEnvelopeItem(
         header, () => utf8JsonEncoder.convert(transaction.toJson()),
-        originalObject: transaction);
+        originalObject: transaction, jsonFactory: transaction.toJson);
   }
 
   factory SentryEnvelopeItem.fromAttachment(SentryAttachment attachment) {
@@ -49,6 +54,7 @@ class SentryEnvelopeItem {
       ),
       () => utf8JsonEncoder.convert(event.toJson()),
       originalObject: event,
+      jsonFactory: event.toJson,
     );
   }
 
@@ -61,6 +67,7 @@ class SentryEnvelopeItem {
       ),
       () => utf8JsonEncoder.convert(clientReport.toJson()),
       originalObject: clientReport,
+      jsonFactory: clientReport.toJson,
     );
   }
 
@@ -76,6 +83,7 @@ class SentryEnvelopeItem {
       ),
       () => utf8JsonEncoder.convert(payload),
       originalObject: payload,
+      jsonFactory: () => payload,
     );
   }
 
@@ -130,4 +138,12 @@ class SentryEnvelopeItem {
 
   /// Create binary data representation of item data.
   final FutureOr<List<int>> Function() dataFactory;
+
+  /// Creates the JSON representation of item data, if the item holds JSON.
+  ///
+  /// Used to encode the item on another isolate: only building the JSON
+  /// has to happen on the calling isolate. [dataFactory] must return the
+  /// UTF-8 encoded result of this.
+  @internal
+  final Object? Function()? jsonFactory;
 }
@@ -9,6 +9,7 @@ import 'client_reports/noop_client_report_recorder.dart';
 import 'diagnostic_log.dart';
 import 'environment/environment_variables.dart';
 import 'http_client/network_details_capture.dart';
+import 'memory_pressure/memory_pressure_source.dart';
 import 'noop_client.dart';
 import 'platform/platform.dart';
 import 'sentry_exception_factory.dart';
@@ -17,6 +18,8 @@ import 'telemetry/log/noop_logger.dart';
 import 'telemetry/metric/noop_metrics.dart';
 import 'telemetry/processing/processor.dart';
 import 'transport/noop_transport.dart';
+import 'utils/sdk_overhead_stats.dart';
+import 'utils/worker_pool.dart';
 import 'version.dart';
 import 'dart:developer' as developer;
 
@@ -62,6 +65,29 @@ class SentryOptions {
   /// text. The compression is enabled by default.
   bool compressPayload = true;
 
+  /// Number of background isolates used to encode and compress envelopes
+  /// before they are sent, so that only a snapshot of the envelope is taken
+  /// on the isolate that captured it.
+  ///
+  /// If `0` (the default), envelopes are encoded on the sending isolate.
+  /// Has no effect on the web, where envelopes are always encoded inline.
+  int envelopeWorkerCount = 0;
+
+  @internal
+  late WorkerPool workerPool = WorkerPool(size: envelopeWorkerCount);
+
+  /// If enabled, the SDK measures the time it spends in its own stages, such
+  /// as event processors, `beforeSend`, serialization, compression and
+  /// screenshot capture. Measurements are kept in memory, see
+  /// [sdkOverheadStats], and emitted as Timeline events. Disabled by
+  /// default.
+  bool enableSdkOverheadStats = false;
+
+  /// The time the SDK spent in its own stages, if [enableSdkOverheadStats]
+  /// is set. Call [SdkOverheadStats.snapshot] to read it, e.g. to export it
+  /// as metrics.
+  late final SdkOverheadStats sdkOverheadStats = SdkOverheadStats(this);
+
   /// If [httpClient] is provided, it is used instead of the default client to
   /// make HTTP calls to Sentry.io. This is useful in tests.
   /// If you don't need to send events, use [NoOpClient].
@@ -276,6 +302,56 @@ class SentryOptions {
   /// If empty, all spans are processed.
   List<IgnoreSpanRule> ignoreSpans = [];
 
+  /// Rules for tail-based sampling of spans when [traceLifecycle] is
+  /// [SentryTraceLifecycle.stream].
+  ///
+  /// When not empty, the finished spans of a segment are held in memory until
+  /// the segment's root span finishes. The segment is sent if any of its spans
+  /// matches any rule, otherwise all of its spans are discarded.
+  ///
+  /// Tail sampling only sees segments that were sampled in by
+  /// [tracesSampleRate] or [tracesSampler], so combine it with a high head
+  /// sample rate to keep rare slow or failing traces.
+  ///
+  /// If empty (the default), tail sampling is disabled.
+  List<TailSamplingRule> tailSamplingRules = [];
+
+  int _tailSamplingMaxSegments = 100;
+
+  /// Maximum number of segments held in memory for tail sampling at a time.
+  /// When exceeded, the oldest segment is decided with the spans it has so
+  /// far. Default is 100.
+  int get tailSamplingMaxSegments => _tailSamplingMaxSegments;
+
+  set tailSamplingMaxSegments(int value) {
+    assert(value > 0);
+    _tailSamplingMaxSegments = value;
+  }
+
+  Duration _tailSamplingMaxSegmentAge = Duration(minutes: 5);
+
+  /// Maximum time a segment is held in memory for tail sampling. When
+  /// exceeded, the segment is decided with the spans it has so far, e.g. if
+  /// its segment span is never finished. Default is 5 minutes.
+  Duration get tailSamplingMaxSegmentAge => _tailSamplingMaxSegmentAge;
+
+  set tailSamplingMaxSegmentAge(Duration value) {
+    assert(value > Duration.zero);
+    _tailSamplingMaxSegmentAge = value;
+  }
+
+  int _tailSamplingMaxSpansPerSegment = 1000;
+
+  /// Maximum number of spans held in memory per segment for tail sampling.
+  /// Further spans of a segment that has not matched a rule yet are
+  /// discarded. Default is 1000.
+  int get tailSamplingMaxSpansPerSegment => _tailSamplingMaxSpansPerSegment;
+
+  set tailSamplingMaxSpansPerSegment(int value) {
+    assert(value > 0);
+    _tailSamplingMaxSpansPerSegment = value;
+  }
+
   final List<String> _inAppExcludes = [];
 
   /// A list of string prefixes of packages names that do not belong to the app, but rather third-party
@@ -400,6 +476,15 @@ class SentryOptions {
     _maxDeduplicationItems = count;
   }
 
+  /// Whether the SDK reads the memory pressure of the process on Linux, from
+  /// the cgroup v2 `memory.pressure` and `memory.events` files, and sheds
+  /// caches and buffered telemetry while memory is tight.
+  ///
+  /// The files are polled with a timer, which keeps a Dart program running
+  /// until [Sentry.close] is called. Disabled by default, `SentryFlutter`
+  /// enables it.
+  bool enableCgroupMemoryPressure = false;
+
   double? _tracesSampleRate;
 
   /// Returns the traces sample rate Default is null (disabled)
@@ -472,6 +557,14 @@ class SentryOptions {
   @internal
   late SdkLifecycleRegistry lifecycleRegistry = SdkLifecycleRegistry(this);
 
+  @internal
+  late final MemoryGovernor memoryGovernor = MemoryGovernor(this);
+
+  /// Sources of memory pressure reported to [memoryGovernor], in addition to
+  /// the cgroup one of [enableCgroupMemoryPressure].
+  @internal
+  final List<MemoryPressureSource> memoryPressureSources = [];
+
   /// List of strings/regex controlling to which outgoing requests
   /// the SDK will attach tracing headers.
   ///
@@ -720,6 +813,15 @@ class SentryOptions {
   late SentryStackTraceFactory stackTraceFactory =
       SentryStackTraceFactory(this);
 
+  /// Aggregates the operations of database integrations into one summary span
+  /// per transaction instead of creating a span and a breadcrumb for each
+  /// operation. Slow and failed operations are still reported on their own.
+  ///
+  /// Supported by the Hive and Isar integrations, and by the sqflite and
+  /// Drift integrations, which summarize SQL statements per fingerprint.
+  /// Disabled by default.
+  SentryOperationAggregation? operationAggregation;
+
   /// Factory for creating instrumentation spans.
   ///
   /// This can be replaced to use different span implementations
@@ -22,8 +22,24 @@ class SentryTracer extends ISentrySpan {
   final Map<String, SentryMeasurement> _measurements = {};
   Map<String, SentryMeasurement> get measurements => _measurements;
 
+  // Children started by this tracer that have not finished yet, so that
+  // finishing with waitForChildren does not scan all children for every
+  // finished child.
+  var _unfinishedChildren = 0;
+  var _startedChildren = 0;
+  // Latest end timestamp of the children started by this tracer, for trimEnd.
+  DateTime? _latestChildEndTimestamp;
+
   Timer? _autoFinishAfterTimer;
   Duration? _autoFinishAfter;
+  // The auto finish timer fires [_autoFinishAfter] after [_autoFinishFrom] on
+  // [_autoFinishStopwatch], which is started when the timer is first armed.
+  // Children started meanwhile only record [_lastChildStartedAt], which the
+  // timer checks when it fires instead of being restarted for every child.
+  // The stopwatch is monotonic, unlike [SentryOptions.clock].
+  final _autoFinishStopwatch = Stopwatch();
+  Duration _autoFinishFrom = Duration.zero;
+  Duration? _lastChildStartedAt;
 
   @visibleForTesting
   Timer? get autoFinishAfterTimer => _autoFinishAfterTimer;
@@ -99,7 +115,9 @@ class SentryTracer extends ISentrySpan {
     final commonEndTimestamp = endTimestamp ?? _hub.options.clock();
     _autoFinishAfterTimer?.cancel();
     _finishStatus = SentryTracerFinishStatus.finishing(status);
-    if (_rootSpan.finished) {
+    // Children that are finished while the root span finishes, e.g. from an
+    // OnSpanFinish callback, call back into finish.
+    if (_rootSpan.finished || _rootSpan.endTimestamp != null) {
       return;
     }
     if (_waitForChildren && !_haveAllChildrenFinished()) {
@@ -116,17 +134,11 @@ class SentryTracer extends ISentrySpan {
 
       // Trim the end timestamp of the transaction to the very last timestamp of child spans
       if (_trimEnd && children.isNotEmpty) {
-        DateTime? latestEndTime;
-
-        for (final child in children) {
-          final childEndTimestamp = child.endTimestamp;
-          if (childEndTimestamp != null) {
-            if (latestEndTime == null ||
-                childEndTimestamp.isAfter(latestEndTime)) {
-              latestEndTime = child.endTimestamp;
-            }
-          }
-        }
+        // The running maximum only covers the children started by this
+        // tracer, scan if spans were added to or removed from [children].
+        final latestEndTime = _children.length == _startedChildren
+            ? _latestChildEndTimestamp
+            : _latestEndTimestampOf(children);
 
         if (latestEndTime != null) {
           _rootEndTimestamp = latestEndTime;
@@ -241,8 +253,8 @@ class SentryTracer extends ISentrySpan {
       return NoOpSentrySpan();
     }
 
-    // reset the timer if a new child is added
-    _scheduleTimer();
+    // postpone the auto finish if a new child is added
+    _postponeTimer();
 
     if (children.length >= _hub.options.maxSpans) {
       _hub.options.log(
@@ -264,10 +276,12 @@ class SentryTracer extends ISentrySpan {
       _hub,
       samplingDecision: _rootSpan.samplingDecision,
       startTimestamp: startTimestamp,
-      finishedCallback: _finishedCallback,
+      finishedCallback: _childFinishedCallback,
     );
 
     _children.add(child);
+    _startedChildren++;
+    _unfinishedChildren++;
 
     for (final collector in _hub.options.performanceCollectors) {
       if (collector is PerformanceContinuousCollector) {
@@ -279,6 +293,19 @@ class SentryTracer extends ISentrySpan {
     return child;
   }
 
+  Future<void> _childFinishedCallback({
+    DateTime? endTimestamp,
+    Hint? hint,
+  }) {
+    _unfinishedChildren--;
+    final latest = _latestChildEndTimestamp;
+    if (endTimestamp != null &&
+        (latest == null || endTimestamp.isAfter(latest))) {
+      _latestChildEndTimestamp = endTimestamp;
+    }
+    return _finishedCallback(endTimestamp: endTimestamp, hint: hint);
+  }
+
   Future<void> _finishedCallback({
     DateTime? endTimestamp,
     Hint? hint,
@@ -333,6 +360,11 @@ class SentryTracer extends ISentrySpan {
   SentryTraceHeader toSentryTrace() => _rootSpan.toSentryTrace();
 
   bool _haveAllChildrenFinished() {
+    if (_unfinishedChildren > 0) {
+      return false;
+    }
+    // Spans can also be added to [children] directly, so confirm once the
+    // counter says that all started children are finished.
     for (final child in children) {
       if (!child.finished) {
         return false;
@@ -341,6 +373,18 @@ class SentryTracer extends ISentrySpan {
     return true;
   }
 
+  static DateTime? _latestEndTimestampOf(List<SentrySpan> spans) {
+    DateTime? latestEndTime;
+    for (final span in spans) {
+      final endTimestamp = span.endTimestamp;
+      if (endTimestamp != null &&
+          (latestEndTime == null || endTimestamp.isAfter(latestEndTime))) {
+        latestEndTime = endTimestamp;
+      }
+    }
+    return latestEndTime;
+  }
+
   bool _hasSpanSuitableTimestamps(
           SentrySpan span, DateTime endTimestampCandidate) =>
       !span.startTimestamp
@@ -436,10 +480,42 @@ class SentryTracer extends ISentrySpan {
     final autoFinishAfter = _autoFinishAfter;
     if (autoFinishAfter != null) {
       _autoFinishAfterTimer?.cancel();
-      _autoFinishAfterTimer = Timer(autoFinishAfter, () async {
-        await finish(status: status ?? SpanStatus.ok());
-      });
+      _autoFinishStopwatch
+        ..reset()
+        ..start();
+      _autoFinishFrom = Duration.zero;
+      _lastChildStartedAt = null;
+      _autoFinishAfterTimer = Timer(autoFinishAfter, _onAutoFinishTimer);
+    }
+  }
+
+  /// Moves the auto finish deadline to [_autoFinishAfter] from now. A running
+  /// timer is kept and re-armed for the remaining time when it fires.
+  void _postponeTimer() {
+    if (_autoFinishAfter == null) {
+      return;
+    }
+    if (_autoFinishAfterTimer?.isActive ?? false) {
+      _lastChildStartedAt = _autoFinishStopwatch.elapsed;
+    } else {
+      _scheduleTimer();
+    }
+  }
+
+  void _onAutoFinishTimer() {
+    final lastChildStartedAt = _lastChildStartedAt;
+    _lastChildStartedAt = null;
+    if (lastChildStartedAt != null) {
+      // The deadline moved by as much as the last child started after the
+      // timer was armed.
+      final postponedBy = lastChildStartedAt - _autoFinishFrom;
+      if (postponedBy > Duration.zero) {
+        _autoFinishFrom = lastChildStartedAt;
+        _autoFinishAfterTimer = Timer(postponedBy, _onAutoFinishTimer);
+        return;
+      }
     }
+    unawaited(finish(status: status ?? SpanStatus.ok()));
   }
 
   void _dispatchOnSpanStart(ISentrySpan span) {
@@ -0,0 +1,302 @@
+import 'dart:collection';
+import 'dart:typed_data';
+
+import 'package:meta/meta.dart';
+
+import '../protocol/sentry_attribute.dart';
+import '../utils.dart';
+
+const _openBrace = 0x7B; // {
+const _closeBrace = 0x7D; // }
+const _comma = 0x2C; // ,
+const _colon = 0x3A; // :
+const _attributesMember = '"attributes":';
+
+/// Compact storage for [SentryAttribute]s, keyed by attribute name.
+///
+/// Spans usually carry fewer than [inlineCapacity] attributes. Up to that
+/// size, keys and values are kept in two parallel lists and looked up with a
+/// linear scan, which is cheaper than a hash map in both memory and time.
+/// Larger stores spill over into a [LinkedHashMap]. Insertion order is kept
+/// in both modes.
+///
+/// Keys are interned and the encoded JSON bytes of keys and of small scalar
+/// values are cached process-wide, so encoding the attributes that repeat on
+/// every span (sdk, release, os, device, ...) is mostly copying bytes.
+@internal
+final class SentryAttributeStore {
+  static const inlineCapacity = 16;
+
+  static const _maxInternedKeys = 1024;
+  static const _maxCachedValues = 512;
+  static const _maxCachedStringLength = 128;
+
+  /// Interned key -> encoded `"key"` bytes.
+  static final Map<String, _InternedKey> _internedKeys = {};
+
+  /// (type, value) -> encoded `{"value":...,"type":...}` bytes.
+  static final Map<(String, Object), List<int>> _encodedValues = {};
+
+  final List<String> _keys = [];
+  final List<SentryAttribute> _values = [];
+  LinkedHashMap<String, SentryAttribute>? _spilled;
+
+  int get length => _spilled?.length ?? _keys.length;
+
+  bool get isEmpty => length == 0;
+
+  bool get isNotEmpty => !isEmpty;
+
+  SentryAttribute? operator [](String key) {
+    final spilled = _spilled;
+    if (spilled != null) {
+      return spilled[key];
+    }
+    final index = _indexOf(key);
+    return index < 0 ? null : _values[index];
+  }
+
+  bool containsKey(String key) =>
+      _spilled?.containsKey(key) ?? _indexOf(key) >= 0;
+
+  void operator []=(String key, SentryAttribute value) {
+    final spilled = _spilled;
+    if (spilled != null) {
+      spilled[key] = value;
+      return;
+    }
+    final index = _indexOf(key);
+    if (index >= 0) {
+      _values[index] = value;
+      return;
+    }
+    if (_keys.length == inlineCapacity) {
+      _spill()[_intern(key)] = value;
+      return;
+    }
+    _keys.add(_intern(key));
+    _values.add(value);
+  }
+
+  /// Sets [key] to [value] unless the store already contains [key].
+  void setIfAbsent(String key, SentryAttribute value) {
+    if (!containsKey(key)) {
+      this[key] = value;
+    }
+  }
+
+  void addAll(Map<String, SentryAttribute> attributes) {
+    for (final entry in attributes.entries) {
+      this[entry.key] = entry.value;
+    }
+  }
+
+  void remove(String key) {
+    final spilled = _spilled;
+    if (spilled != null) {
+      spilled.remove(key);
+      return;
+    }
+    final index = _indexOf(key);
+    if (index >= 0) {
+      _keys.removeAt(index);
+      _values.removeAt(index);
+    }
+  }
+
+  void forEach(void Function(String key, SentryAttribute value) action) {
+    final spilled = _spilled;
+    if (spilled != null) {
+      spilled.forEach(action);
+      return;
+    }
+    for (var i = 0; i < _keys.length; i++) {
+      action(_keys[i], _values[i]);
+    }
+  }
+
+  /// A read-only view of this store. The view is not a copy and reflects
+  /// later changes to the store.
+  Map<String, SentryAttribute> asUnmodifiableMap() =>
+      _SentryAttributeStoreView(this);
+
+  Map<String, dynamic> toJson() {
+    final json = <String, dynamic>{};
+    forEach((key, value) => json[key] = value.toJson());
+    return json;
+  }
+
+  /// Writes this store as a JSON object to [out].
+  void writeJson(BytesBuilder out) {
+    out.addByte(_openBrace);
+    var first = true;
+    forEach((key, value) {
+      if (!first) {
+        out.addByte(_comma);
+      }
+      first = false;
+      _writeEntry(out, key, value);
+    });
+    out.addByte(_closeBrace);
+  }
+
+  /// Writes [attributes] as a JSON object to [out], using the same cached
+  /// key and value encodings as [writeJson].
+  static void writeJsonMap(
+    Map<String, SentryAttribute> attributes,
+    BytesBuilder out,
+  ) {
+    out.addByte(_openBrace);
+    var first = true;
+    for (final entry in attributes.entries) {
+      if (!first) {
+        out.addByte(_comma);
+      }
+      first = false;
+      _writeEntry(out, entry.key, entry.value);
+    }
+    out.addByte(_closeBrace);
+  }
+
+  /// Encodes [json] as UTF-8 JSON with an additional `attributes` member
+  /// that is written by [writeAttributes].
+  ///
+  /// This lets callers encode the attributes from cached bytes instead of
+  /// building a `toJson()` map per attribute first.
+  static List<int> encodeWithAttributes(
+    Map<String, dynamic> json,
+    void Function(BytesBuilder out) writeAttributes,
+  ) {
+    final head = utf8JsonEncoder.convert(json);
+    final out = BytesBuilder();
+    // Everything but the closing brace of the encoded object.
+    final headLength = head.length - 1;
+    out.add(head is Uint8List
+        ? Uint8List.sublistView(head, 0, headLength)
+        : head.sublist(0, headLength));
+    if (json.isNotEmpty) {
+      out.addByte(_comma);
+    }
+    out.add(_attributesMemberBytes);
+    writeAttributes(out);
+    out.addByte(_closeBrace);
+    return out.takeBytes();
+  }
+
+  static final List<int> _attributesMemberBytes =
+      Uint8List.fromList(_attributesMember.codeUnits);
+
+  static void _writeEntry(BytesBuilder out, String key, SentryAttribute value) {
+    out.add(_encodedKey(key));
+    out.addByte(_colon);
+    out.add(_encodedValue(value));
+  }
+
+  int _indexOf(String key) {
+    final keys = _keys;
+    for (var i = 0; i < keys.length; i++) {
+      final candidate = keys[i];
+      if (identical(candidate, key) || candidate == key) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  LinkedHashMap<String, SentryAttribute> _spill() {
+    final spilled = LinkedHashMap<String, SentryAttribute>.fromIterables(
+      _keys,
+      _values,
+    );
+    _keys.clear();
+    _values.clear();
+    return _spilled = spilled;
+  }
+
+  static String _intern(String key) {
+    final interned = _internedKeys[key];
+    if (interned != null) {
+      return interned.key;
+    }
+    if (_internedKeys.length < _maxInternedKeys) {
+      _internedKeys[key] = _InternedKey(key);
+    }
+    return key;
+  }
+
+  static List<int> _encodedKey(String key) =>
+      _internedKeys[key]?.encoded ?? utf8JsonEncoder.convert(key);
+
+  static List<int> _encodedValue(SentryAttribute attribute) {
+    final value = attribute.value;
+    final cacheable = value is bool ||
+        value is int ||
+        (value is String && value.length <= _maxCachedStringLength);
+    if (!cacheable) {
+      return utf8JsonEncoder.convert(attribute.toJson());
+    }
+
+    final cacheKey = (attribute.type, value as Object);
+    final cached = _encodedValues[cacheKey];
+    if (cached != null) {
+      return cached;
+    }
+    if (_encodedValues.length >= _maxCachedValues) {
+      // Start over rather than tracking recency; values that repeat across
+      // spans will be cached again right away.
+      _encodedValues.clear();
+    }
+    return _encodedValues[cacheKey] =
+        utf8JsonEncoder.convert(attribute.toJson());
+  }
+}
+
+final class _InternedKey {
+  final String key;
+  final List<int> encoded;
+
+  _InternedKey(this.key) : encoded = utf8JsonEncoder.convert(key);
+}
+
+final class _SentryAttributeStoreView
+    extends UnmodifiableMapBase<String, SentryAttribute> {
+  final SentryAttributeStore _store;
+
+  _SentryAttributeStoreView(this._store);
+
+  @override
+  SentryAttribute? operator [](Object? key) =>
+      key is String ? _store[key] : null;
+
+  @override
+  bool containsKey(Object? key) => key is String && _store.containsKey(key);
+
+  @override
+  int get length => _store.length;
+
+  @override
+  bool get isEmpty => _store.isEmpty;
+
+  @override
+  bool get isNotEmpty => _store.isNotEmpty;
+
+  @override
+  Iterable<String> get keys =>
+      _store._spilled?.keys ?? UnmodifiableListView(_store._keys);
+
+  @override
+  Iterable<MapEntry<String, SentryAttribute>> get entries {
+    final spilled = _store._spilled;
+    if (spilled != null) {
+      return spilled.entries;
+    }
+    return Iterable.generate(
+      _store._keys.length,
+      (i) => MapEntry(_store._keys[i], _store._values[i]),
+    );
+  }
+
+  @override
+  void forEach(void Function(String key, SentryAttribute value) action) =>
+      _store.forEach(action);
+}
@@ -1,7 +1,10 @@
+import 'package:meta/meta.dart';
+
 import '../../protocol/sentry_attribute.dart';
 import '../../protocol/sentry_id.dart';
 import '../../protocol/span_id.dart';
 import '../../utils/date_time_extension.dart';
+import '../attribute_store.dart';
 import 'log_level.dart';
 
 class SentryLog {
@@ -27,14 +30,32 @@ class SentryLog {
   }) : traceId = traceId ?? SentryId.empty();
 
   Map<String, dynamic> toJson() {
+    return {
+      ..._toJsonWithoutAttributes(),
+      'attributes':
+          attributes.map((key, value) => MapEntry(key, value.toJson())),
+    };
+  }
+
+  /// Encodes this log as UTF-8 JSON.
+  ///
+  /// Equivalent to encoding [toJson], but the attributes are written from
+  /// cached key and value encodings instead of intermediate maps.
+  @internal
+  List<int> toJsonBytes() {
+    return SentryAttributeStore.encodeWithAttributes(
+      _toJsonWithoutAttributes(),
+      (out) => SentryAttributeStore.writeJsonMap(attributes, out),
+    );
+  }
+
+  Map<String, dynamic> _toJsonWithoutAttributes() {
     return {
       'timestamp': timestamp.secondsSinceEpoch,
       'trace_id': traceId.toString(),
       if (spanId != null) 'span_id': spanId.toString(),
       'level': level.value,
       'body': body,
-      'attributes':
-          attributes.map((key, value) => MapEntry(key, value.toJson())),
       'severity_number': severityNumber ?? level.toSeverityNumber(),
     };
   }
@@ -14,6 +14,15 @@ class LogCapturePipeline {
   LogCapturePipeline(this._options);
 
   FutureOr<void> captureLog(SentryLog log, {Scope? scope}) async {
+    if (_options.memoryGovernor.shouldDropLog(log)) {
+      // Not encoded to count its bytes, that would take the memory the drop
+      // is meant to save.
+      _options.recorder.recordLostLog(DiscardReason.backpressure);
+      internalLogger.debug(() =>
+          '$LogCapturePipeline: Log "${log.body}" dropped under memory pressure');
+      return;
+    }
+
     try {
       if (scope != null) {
         // Populate traceId from scope if not already set
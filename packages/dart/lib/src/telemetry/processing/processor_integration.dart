@@ -40,7 +40,8 @@ class InMemoryTelemetryProcessorIntegration extends Integration<SentryOptions> {
 
   InMemoryTelemetryBuffer<SentryLog> _createLogBuffer(SentryOptions options) =>
       InMemoryTelemetryBuffer(
-        encoder: (SentryLog item) => utf8JsonEncoder.convert(item.toJson()),
+        encoder: (SentryLog item) => options.sdkOverheadStats
+            .measure(SdkOverheadStage.telemetryEncoding, item.toJsonBytes),
         onDrop: (item, {required cause, bytes}) {
           switch (cause) {
             case BufferDropCause.encodeFailed:
@@ -66,8 +67,8 @@ class InMemoryTelemetryProcessorIntegration extends Integration<SentryOptions> {
     SentryOptions options,
   ) =>
       GroupedInMemoryTelemetryBuffer(
-        encoder: (RecordingSentrySpanV2 item) =>
-            utf8JsonEncoder.convert(item.toJson()),
+        encoder: (RecordingSentrySpanV2 item) => options.sdkOverheadStats
+            .measure(SdkOverheadStage.telemetryEncoding, item.toJsonBytes),
         onDrop: (item, {required cause, bytes}) {
           switch (cause) {
             case BufferDropCause.encodeFailed:
@@ -105,7 +106,9 @@ class InMemoryTelemetryProcessorIntegration extends Integration<SentryOptions> {
     SentryOptions options,
   ) =>
       InMemoryTelemetryBuffer(
-        encoder: (SentryMetric item) => utf8JsonEncoder.convert(item.toJson()),
+        encoder: (SentryMetric item) => options.sdkOverheadStats.measure(
+            SdkOverheadStage.telemetryEncoding,
+            () => utf8JsonEncoder.convert(item.toJson())),
         onDrop: (item, {required cause, bytes}) {
           switch (cause) {
             case BufferDropCause.encodeFailed:
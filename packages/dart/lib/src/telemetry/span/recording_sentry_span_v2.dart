@@ -23,7 +23,7 @@ base class RecordingSentrySpanV2 implements SentrySpanV2 {
   final SentryId _traceId;
   final RecordingSentrySpanV2? _segmentSpan;
   final DscCreatorCallback _dscCreator;
-  final Map<String, SentryAttribute> _attributes = {};
+  final SentryAttributeStore _attributes = SentryAttributeStore();
   final SentryTracesSamplingDecision _samplingDecision;
 
   // Mutable span state.
@@ -169,7 +169,8 @@ base class RecordingSentrySpanV2 implements SentrySpanV2 {
   bool get isEnded => _endTimestamp != null;
 
   @override
-  Map<String, SentryAttribute> get attributes => Map.unmodifiable(_attributes);
+  Map<String, SentryAttribute> get attributes =>
+      _attributes.asUnmodifiableMap();
 
   @override
   void setAttribute(String key, SentryAttribute value) {
@@ -183,7 +184,7 @@ base class RecordingSentrySpanV2 implements SentrySpanV2 {
 
   void setAttributesIfAbsent(Map<String, SentryAttribute> attributes) {
     for (final entry in attributes.entries) {
-      _attributes.putIfAbsent(entry.key, () => entry.value);
+      _attributes.setIfAbsent(entry.key, entry.value);
     }
   }
 
@@ -193,6 +194,29 @@ base class RecordingSentrySpanV2 implements SentrySpanV2 {
   }
 
   Map<String, dynamic> toJson() {
+    return {
+      ..._toJsonWithoutAttributes(),
+      if (_attributes.isNotEmpty) 'attributes': _attributes.toJson(),
+    };
+  }
+
+  /// Encodes this span as UTF-8 JSON.
+  ///
+  /// Equivalent to encoding [toJson], but the attributes are written from
+  /// cached key and value encodings instead of intermediate maps.
+  @internal
+  List<int> toJsonBytes() {
+    final json = _toJsonWithoutAttributes();
+    if (_attributes.isEmpty) {
+      return utf8JsonEncoder.convert(json);
+    }
+    return SentryAttributeStore.encodeWithAttributes(
+      json,
+      _attributes.writeJson,
+    );
+  }
+
+  Map<String, dynamic> _toJsonWithoutAttributes() {
     double toUnixSeconds(DateTime timestamp) =>
         timestamp.microsecondsSinceEpoch / 1000000;
 
@@ -205,10 +229,6 @@ base class RecordingSentrySpanV2 implements SentrySpanV2 {
       'end_timestamp':
           _endTimestamp == null ? null : toUnixSeconds(_endTimestamp!),
       'start_timestamp': toUnixSeconds(_startTimestamp),
-      // Create a copy of attributes in case attributes are mutated during serialization
-      if (_attributes.isNotEmpty)
-        'attributes': Map.from(_attributes)
-            .map((key, value) => MapEntry(key, value.toJson())),
       if (_parentSpan != null) 'parent_span_id': _parentSpan.spanId.toString(),
     };
   }
@@ -6,6 +6,7 @@ import 'package:meta/meta.dart';
 
 import '../../../sentry.dart';
 import '../../utils/internal_logger.dart';
+import '../attribute_store.dart';
 
 part 'unset_sentry_span_v2.dart';
 part 'recording_sentry_span_v2.dart';
@@ -52,9 +53,10 @@ sealed class SentrySpanV2 {
   /// If omitted, this span ends using the current time when end is executed.
   void end({DateTime? endTimestamp});
 
-  /// The read-only view of the attributes of this span using [Map.unmodifiable](https://api.flutter.dev/flutter/dart-core/Map/Map.unmodifiable.html).
+  /// The read-only view of the attributes of this span.
   ///
-  /// The returned map must not be mutated by callers.
+  /// The returned map must not be mutated by callers. Copy it with
+  /// [Map.of] if a snapshot is needed.
   Map<String, SentryAttribute> get attributes;
 
   /// Sets an attribute on this span, replacing any existing attribute with the same key.
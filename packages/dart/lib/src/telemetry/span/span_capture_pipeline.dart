@@ -3,13 +3,20 @@ import 'package:meta/meta.dart';
 import '../../../sentry.dart';
 import '../../utils/internal_logger.dart';
 import '../default_attributes.dart';
+import 'tail_sampling_buffer.dart';
 
 @internal
 class SpanCapturePipeline {
   final SentryOptions _options;
 
+  TailSamplingBuffer? _tailSamplingBuffer;
+
   SpanCapturePipeline(this._options);
 
+  @visibleForTesting
+  int get pendingTailSamplingSegmentCount =>
+      _tailSamplingBuffer?.pendingSegmentCount ?? 0;
+
   Future<void> captureSpan(SentrySpanV2 span, {Scope? scope}) async {
     if (_options.traceLifecycle == SentryTraceLifecycle.static) {
       internalLogger.warning(
@@ -67,7 +74,15 @@ class SpanCapturePipeline {
             }
           }
 
-          _options.telemetryProcessor.addSpan(span);
+          if (_options.tailSamplingRules.isEmpty) {
+            _options.telemetryProcessor.addSpan(span);
+          } else {
+            _tailSamplingBuffer ??= TailSamplingBuffer(
+              _options,
+              (span) => _options.telemetryProcessor.addSpan(span),
+            );
+            _tailSamplingBuffer!.add(span);
+          }
         } catch (error, stackTrace) {
           internalLogger.error(
             'Error while capturing span ${span.name}',
@@ -80,4 +95,10 @@ class SpanCapturePipeline {
         }
     }
   }
+
+  /// Decides the segments still held for tail sampling, so that their spans
+  /// are sent or recorded as dropped before the SDK closes.
+  void close() {
+    _tailSamplingBuffer?.close();
+  }
 }
@@ -0,0 +1,158 @@
+import 'dart:collection';
+
+import 'package:meta/meta.dart';
+
+import '../../../sentry.dart';
+import '../../client_reports/discard_reason.dart';
+import '../../transport/data_category.dart';
+import '../../utils/internal_logger.dart';
+
+/// Holds the finished spans of a segment until its root span finishes, then
+/// keeps or discards the whole segment based on
+/// [SentryOptions.tailSamplingRules].
+///
+/// Memory is bounded by [SentryOptions.tailSamplingMaxSegments],
+/// [SentryOptions.tailSamplingMaxSegmentAge] and
+/// [SentryOptions.tailSamplingMaxSpansPerSegment]. When too many segments are
+/// pending, or a segment is pending for too long, it is decided early with
+/// what is known so far. Spans beyond the per-segment limit are dropped
+/// unless the segment already matched a rule. Segments still pending on
+/// [close] are decided the same way.
+@internal
+class TailSamplingBuffer {
+  final SentryOptions _options;
+  final void Function(RecordingSentrySpanV2 span) _onKeep;
+
+  /// Pending segments keyed by their segment span, oldest first.
+  final _pending =
+      LinkedHashMap<RecordingSentrySpanV2, _PendingSegment>.identity();
+
+  /// Decisions attached to the segment spans, so that children ending after
+  /// their segment was decided follow the same decision for as long as the
+  /// segment span is alive.
+  final _decisions = Expando<bool>('tail sampling decision');
+
+  /// Age of the pending segments, see [_PendingSegment.startedAt].
+  final _stopwatch = Stopwatch()..start();
+
+  TailSamplingBuffer(this._options, this._onKeep);
+
+  int get pendingSegmentCount => _pending.length;
+
+  /// Adds a finished [span]. Spans of kept segments are passed on to the
+  /// keep callback; all other spans are held or dropped.
+  void add(RecordingSentrySpanV2 span) {
+    final segmentSpan = span.segmentSpan;
+
+    final decision = _decisions[segmentSpan];
+    if (decision != null) {
+      decision ? _onKeep(span) : _recordDropped(1);
+      return;
+    }
+
+    _evictExpired();
+
+    final isSegmentSpan = identical(span, segmentSpan);
+    var segment = _pending[segmentSpan];
+    if (segment == null) {
+      segment = _PendingSegment(_stopwatch.elapsed);
+      if (!isSegmentSpan) {
+        if (_pending.length >= _options.tailSamplingMaxSegments) {
+          _evictOldest();
+        }
+        _pending[segmentSpan] = segment;
+      }
+    }
+
+    if (!segment.matched && _matches(span)) {
+      segment.matched = true;
+      segment.spans.forEach(_onKeep);
+      segment.spans.clear();
+    }
+
+    if (segment.matched) {
+      _onKeep(span);
+    } else if (segment.spans.length <
+        _options.tailSamplingMaxSpansPerSegment) {
+      segment.spans.add(span);
+    } else {
+      _recordDropped(1);
+    }
+
+    if (isSegmentSpan) {
+      _pending.remove(segmentSpan);
+      _decide(segmentSpan, segment);
+    }
+  }
+
+  /// Decides all pending segments with the spans they have so far.
+  void close() {
+    final pending = _pending.entries.toList();
+    _pending.clear();
+    for (final entry in pending) {
+      _decide(entry.key, entry.value);
+    }
+  }
+
+  void _evictExpired() {
+    final maxAge = _options.tailSamplingMaxSegmentAge;
+    final now = _stopwatch.elapsed;
+    while (_pending.isNotEmpty &&
+        now - _pending.values.first.startedAt > maxAge) {
+      final oldest = _pending.keys.first;
+      final segment = _pending.remove(oldest)!;
+      internalLogger.debug(
+        '$TailSamplingBuffer: Segment ${oldest.name} pending for too long, deciding it early',
+      );
+      _decide(oldest, segment);
+    }
+  }
+
+  void _evictOldest() {
+    final oldest = _pending.keys.first;
+    final segment = _pending.remove(oldest)!;
+    internalLogger.debug(
+      '$TailSamplingBuffer: Too many pending segments, deciding ${oldest.name} early',
+    );
+    _decide(oldest, segment);
+  }
+
+  void _decide(RecordingSentrySpanV2 segmentSpan, _PendingSegment segment) {
+    // Unmatched segments are dropped; kept spans were already passed on.
+    if (!segment.matched) {
+      _recordDropped(segment.spans.length);
+    }
+    segment.spans.clear();
+    _decisions[segmentSpan] = segment.matched;
+  }
+
+  bool _matches(RecordingSentrySpanV2 span) {
+    for (final rule in _options.tailSamplingRules) {
+      if (rule.appliesTo(span)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void _recordDropped(int count) {
+    if (count == 0) {
+      return;
+    }
+    _options.recorder.recordLostEvent(
+      DiscardReason.sampleRate,
+      DataCategory.span,
+      count: count,
+    );
+  }
+}
+
+class _PendingSegment {
+  /// When the first span of the segment was added, on
+  /// [TailSamplingBuffer._stopwatch].
+  final Duration startedAt;
+  final List<RecordingSentrySpanV2> spans = [];
+  bool matched = false;
+
+  _PendingSegment(this.startedAt);
+}
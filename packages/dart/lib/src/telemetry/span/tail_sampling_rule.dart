@@ -0,0 +1,69 @@
+import 'package:meta/meta.dart';
+
+import '../../../sentry.dart';
+
+/// A rule that decides whether a finished span makes its whole segment worth
+/// keeping when tail sampling is enabled.
+///
+/// See [SentryOptions.tailSamplingRules].
+sealed class TailSamplingRule {
+  const TailSamplingRule();
+
+  /// Keeps the segment if any of its spans has an error status.
+  const factory TailSamplingRule.error() = _Error;
+
+  /// Keeps the segment if any of its spans took at least [threshold].
+  const factory TailSamplingRule.durationAtLeast(Duration threshold) =
+      _DurationAtLeast;
+
+  /// Keeps the segment if any of its spans has the given `sentry.op`.
+  const factory TailSamplingRule.op(String op) = _Op;
+
+  /// Keeps the segment if [test] returns true for any of its spans.
+  const factory TailSamplingRule.custom(bool Function(SentrySpanV2 span) test) =
+      _Custom;
+
+  @internal
+  bool appliesTo(SentrySpanV2 span);
+}
+
+class _Error extends TailSamplingRule {
+  const _Error();
+
+  @override
+  bool appliesTo(SentrySpanV2 span) => span.status == SentrySpanStatusV2.error;
+}
+
+class _DurationAtLeast extends TailSamplingRule {
+  final Duration threshold;
+
+  const _DurationAtLeast(this.threshold);
+
+  @override
+  bool appliesTo(SentrySpanV2 span) {
+    final endTimestamp = span.endTimestamp;
+    if (endTimestamp == null) {
+      return false;
+    }
+    return endTimestamp.difference(span.startTimestamp) >= threshold;
+  }
+}
+
+class _Op extends TailSamplingRule {
+  final String op;
+
+  const _Op(this.op);
+
+  @override
+  bool appliesTo(SentrySpanV2 span) =>
+      span.attributes[SemanticAttributesConstants.sentryOp]?.value == op;
+}
+
+class _Custom extends TailSamplingRule {
+  final bool Function(SentrySpanV2 span) test;
+
+  const _Custom(this.test);
+
+  @override
+  bool appliesTo(SentrySpanV2 span) => test(span);
+}
@@ -5,3 +5,4 @@ export 'log/logger.dart';
 export 'span/sentry_span_v2.dart';
 export 'span/sentry_span_status_v2.dart';
 export 'span/ignore_span_rule.dart';
+export 'span/tail_sampling_rule.dart';
@@ -2,5 +2,7 @@
 library;
 
 export 'instrumentation_span.dart';
+export 'operation_aggregator.dart';
 export 'span_factory.dart';
+export 'sql_fingerprint.dart';
 export 'synchronous_span_marker.dart';
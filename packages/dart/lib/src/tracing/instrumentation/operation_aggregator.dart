@@ -0,0 +1,498 @@
+import 'dart:async';
+
+import 'package:meta/meta.dart';
+
+import '../../../sentry.dart';
+
+/// Configures integrations to aggregate frequent operations, such as key-value
+/// store reads and writes, instead of creating a span and a breadcrumb for
+/// each of them. See [SentryOptions.operationAggregation].
+///
+/// Operations are summarized per transaction into a single span, with a
+/// count, the number of errors, the total and maximum duration, the payload
+/// size and a latency histogram per database and operation. SQL statements
+/// are summarized into one span per statement fingerprint instead, which also
+/// counts the rows they returned or affected. Operations that fail or take at
+/// least [outlierThreshold] are still reported individually.
+class SentryOperationAggregation {
+  /// Operations that take at least this long get their own span and
+  /// breadcrumb in addition to being counted in the summary.
+  final Duration outlierThreshold;
+
+  /// How long operations are collected into the same summary span, starting
+  /// with the first operation. A transaction can have several summary spans
+  /// if it runs longer than this.
+  ///
+  /// A summary span is finished before its parent span, but a transaction
+  /// that waits for its children (`waitForChildren`) only finishes its root
+  /// span once all children finished. Such a transaction can therefore be
+  /// held up by an open summary span for up to this long.
+  final Duration interval;
+
+  /// Maximum number of distinct database and operation pairs per summary
+  /// span. Further pairs are counted as [otherGroup].
+  final int maxGroups;
+
+  /// Maximum number of parent spans with open summary spans at a time. When
+  /// operations start under one more parent span, the summary spans of the
+  /// parent that got its first one the earliest are finished.
+  final int maxParentSpans;
+
+  const SentryOperationAggregation({
+    this.outlierThreshold = const Duration(milliseconds: 16),
+    this.interval = const Duration(seconds: 1),
+    this.maxGroups = 50,
+    this.maxParentSpans = 10,
+  });
+
+  /// Group of the operations above [maxGroups].
+  static const otherGroup = 'other';
+}
+
+/// Collects operations of a database integration into summary spans, see
+/// [SentryOperationAggregation].
+///
+/// Operations are summarized per parent span, so interleaved operations of
+/// concurrent transactions do not finish each other's summary spans. The
+/// summary spans are finished when their parent span finishes, after
+/// [SentryOperationAggregation.interval] or when
+/// [SentryOperationAggregation.maxParentSpans] is exceeded, whichever comes
+/// first.
+@internal
+class OperationAggregator {
+  static const dataPrefix = 'db.aggregate';
+
+  /// Upper bounds in microseconds of all but the last histogram bucket. The
+  /// last bucket counts everything above.
+  static const histogramBoundsMicros = [
+    64,
+    128,
+    256,
+    512,
+    1024,
+    2048,
+    4096,
+    8192,
+    16384,
+    32768,
+    65536,
+  ];
+
+  static final _aggregators = Expando<Map<String, OperationAggregator>>();
+
+  final Hub _hub;
+  final SentryOperationAggregation _config;
+  final String _operation;
+  final String _system;
+  final String _origin;
+  final bool _spanPerName;
+
+  /// The open summary windows by parent span, oldest first.
+  final _windows = <InstrumentationSpan, _Window>{};
+
+  OperationAggregator._(
+    this._hub,
+    this._config,
+    this._operation,
+    this._system,
+    this._origin,
+    this._spanPerName,
+  ) {
+    _hub.options.lifecycleRegistry
+      ..registerCallback<OnSpanFinish>(_onSpanFinish)
+      ..registerCallback<OnSpanEndV2>(_onSpanEnd);
+  }
+
+  /// Returns the aggregator for [operation] on the database [system] of
+  /// [hub], or `null` if [SentryOptions.operationAggregation] is not set.
+  ///
+  /// With [spanPerName], every distinct operation name gets a summary span of
+  /// its own, described by the name. This is used for SQL, where the name is
+  /// the statement fingerprint, so the summary spans are grouped like the
+  /// statements they stand for.
+  static OperationAggregator? of(
+    Hub hub, {
+    required String operation,
+    required String system,
+    required String origin,
+    bool spanPerName = false,
+  }) {
+    final options = hub.options;
+    final config = options.operationAggregation;
+    if (config == null) {
+      return null;
+    }
+    final aggregators = _aggregators[options] ??= {};
+    return aggregators['$operation $system $origin'] ??= OperationAggregator._(
+      hub,
+      config,
+      operation,
+      system,
+      origin,
+      spanPerName,
+    );
+  }
+
+  /// Records an operation named [name] on the database [group] and returns
+  /// whether it should also be reported on its own, because it failed or is
+  /// an outlier. [rows] is the number of rows the operation returned or
+  /// affected, if known.
+  ///
+  /// The operation is added to the summary span of [parentSpan]. Without a
+  /// parent span there is no transaction to summarize into, so only the
+  /// result is returned.
+  bool record(
+    InstrumentationSpan? parentSpan, {
+    required String group,
+    required String name,
+    required DateTime start,
+    required DateTime end,
+    int? bytes,
+    int? rows,
+    bool failed = false,
+  }) {
+    final durationMicros = end.difference(start).inMicroseconds;
+    final report =
+        failed || durationMicros >= _config.outlierThreshold.inMicroseconds;
+    if (parentSpan == null) {
+      return report;
+    }
+
+    var window = _windows[parentSpan];
+    if (window == null) {
+      if (_windows.length >= _config.maxParentSpans) {
+        _flushWindow(_windows.keys.first);
+      }
+      window = _windows[parentSpan] = _Window(
+        parentSpan,
+        _spanPerName
+            ? null
+            : _startSpan(parentSpan, start, 'aggregated $_system operations'),
+        start,
+        Timer(_config.interval, () => _flushWindow(parentSpan)),
+      );
+    }
+
+    var key = '$group.$name';
+    var stats = window.stats[key];
+    if (stats == null) {
+      var description = name;
+      String? dbName = group;
+      if (window.stats.length >= _config.maxGroups) {
+        key = description = SentryOperationAggregation.otherGroup;
+        dbName = null;
+      }
+      stats = window.stats[key] ??= _Stats(
+        _spanPerName
+            ? _startSpan(parentSpan, start, description, dbName: dbName)
+            : null,
+        end,
+      );
+    }
+    stats.add(durationMicros, bytes: bytes, rows: rows, failed: failed);
+    if (end.isAfter(stats.end)) {
+      stats.end = end;
+    }
+    if (end.isAfter(window.end)) {
+      window.end = end;
+    }
+    return report;
+  }
+
+  /// Runs [execute] and [record]s it as the operation [name].
+  ///
+  /// If the operation failed or is an outlier, it is also reported on its
+  /// own: with a span under [parentSpan], described by [description] or else
+  /// [name], to which [setSpanData] adds the data of the integration, and
+  /// with the breadcrumb built by [breadcrumb], if any. Both get the status
+  /// of the operation. [rowsOf] returns the number of rows returned or
+  /// affected by the operation.
+  Future<T> run<T>(
+    InstrumentationSpan? parentSpan, {
+    required String group,
+    required String name,
+    required Future<T> Function() execute,
+    String? description,
+    String? origin,
+    int? bytes,
+    int? Function(T result)? rowsOf,
+    void Function(InstrumentationSpan span)? setSpanData,
+    Breadcrumb Function()? breadcrumb,
+  }) async {
+    final start = _hub.options.clock();
+    Object? exception;
+    int? rows;
+    try {
+      final result = await execute();
+      rows = rowsOf?.call(result);
+      return result;
+    } catch (e) {
+      exception = e;
+      rethrow;
+    } finally {
+      await _recordRun(
+        parentSpan,
+        start,
+        group: group,
+        name: name,
+        description: description,
+        origin: origin,
+        bytes: bytes,
+        rows: rows,
+        exception: exception,
+        setSpanData: setSpanData,
+        breadcrumb: breadcrumb,
+      );
+    }
+  }
+
+  /// Like [run], for a synchronous operation.
+  T runSync<T>(
+    InstrumentationSpan? parentSpan, {
+    required String group,
+    required String name,
+    required T Function() execute,
+    String? description,
+    String? origin,
+    int? bytes,
+    void Function(InstrumentationSpan span)? setSpanData,
+    Breadcrumb Function()? breadcrumb,
+  }) {
+    final start = _hub.options.clock();
+    Object? exception;
+    try {
+      return execute();
+    } catch (e) {
+      exception = e;
+      rethrow;
+    } finally {
+      // Records synchronously, only finishing the outlier span and adding
+      // the breadcrumb is asynchronous.
+      unawaited(_recordRun(
+        parentSpan,
+        start,
+        group: group,
+        name: name,
+        description: description,
+        origin: origin,
+        bytes: bytes,
+        rows: null,
+        exception: exception,
+        setSpanData: setSpanData,
+        breadcrumb: breadcrumb,
+      ));
+    }
+  }
+
+  Future<void> _recordRun(
+    InstrumentationSpan? parentSpan,
+    DateTime start, {
+    required String group,
+    required String name,
+    required String? description,
+    required String? origin,
+    required int? bytes,
+    required int? rows,
+    required Object? exception,
+    required void Function(InstrumentationSpan span)? setSpanData,
+    required Breadcrumb Function()? breadcrumb,
+  }) async {
+    final end = _hub.options.clock();
+    final failed = exception != null;
+    final report = record(
+      parentSpan,
+      group: group,
+      name: name,
+      start: start,
+      end: end,
+      bytes: bytes,
+      rows: rows,
+      failed: failed,
+    );
+    if (!report) {
+      return;
+    }
+
+    final span = parentSpan != null
+        ? _hub.options.spanFactory.createSpan(
+            parentSpan: parentSpan,
+            operation: _operation,
+            description: description ?? name,
+            startTimestamp: start,
+          )
+        : null;
+    if (span != null) {
+      span.origin = origin ?? _origin;
+      setSpanData?.call(span);
+      span.throwable = exception;
+      span.status = failed ? SpanStatus.internalError() : SpanStatus.ok();
+      await span.finish(endTimestamp: end);
+    }
+
+    final crumb = breadcrumb?.call();
+    if (crumb != null) {
+      crumb.data?['status'] = failed ? 'internal_error' : 'ok';
+      if (failed) {
+        crumb.level = SentryLevel.warning;
+      }
+      await _hub.scope.addBreadcrumb(crumb);
+    }
+  }
+
+  InstrumentationSpan? _startSpan(
+    InstrumentationSpan parentSpan,
+    DateTime start,
+    String description, {
+    String? dbName,
+  }) {
+    final span = _hub.options.spanFactory.createSpan(
+      parentSpan: parentSpan,
+      operation: _operation,
+      description: description,
+      startTimestamp: start,
+    );
+    span?.origin = _origin;
+    span?.setData(SentrySpanData.dbSystemKey, _system);
+    if (dbName != null && dbName != _system) {
+      span?.setData(SentrySpanData.dbNameKey, dbName);
+    }
+    span?.setData(
+      '$dataPrefix.histogram_bounds_us',
+      histogramBoundsMicros,
+    );
+    return span;
+  }
+
+  /// Finishes the current summary spans.
+  void flush() {
+    for (final parentSpan in List.of(_windows.keys)) {
+      _flushWindow(parentSpan);
+    }
+  }
+
+  /// Finishes the summary spans of [parentSpan].
+  void _flushWindow(InstrumentationSpan parentSpan) {
+    final window = _windows.remove(parentSpan);
+    if (window == null) {
+      return;
+    }
+    window.timer.cancel();
+
+    final summary = window.span;
+    var failed = false;
+    window.stats.forEach((key, stats) {
+      if (summary != null) {
+        failed |= stats.writeTo(summary, '$dataPrefix.$key');
+        return;
+      }
+      final span = stats.span;
+      if (span != null) {
+        _finish(span, stats.writeTo(span, dataPrefix), stats.end);
+      }
+    });
+    if (summary != null) {
+      _finish(summary, failed, window.end);
+    }
+  }
+
+  // The summary spans have to be finished before their parent, otherwise a
+  // transaction would be sent with unfinished summary spans without data.
+  void _onSpanFinish(OnSpanFinish event) {
+    for (final parentSpan in _windows.keys) {
+      if (parentSpan is LegacyInstrumentationSpan &&
+          parentSpan.spanReference.context.spanId ==
+              event.span.context.spanId) {
+        _flushWindow(parentSpan);
+        return;
+      }
+    }
+  }
+
+  void _onSpanEnd(OnSpanEndV2 event) {
+    if (_windows.isNotEmpty) {
+      _flushWindow(StreamingInstrumentationSpan(event.span));
+    }
+  }
+
+  void _finish(InstrumentationSpan span, bool failed, DateTime end) {
+    unawaited(span.finish(
+      status: failed ? SpanStatus.internalError() : SpanStatus.ok(),
+      endTimestamp: end,
+    ));
+  }
+}
+
+class _Window {
+  final InstrumentationSpan parentSpan;
+
+  /// The summary span of all operations, unless there is one per name.
+  final InstrumentationSpan? span;
+  final Timer timer;
+  final stats = <String, _Stats>{};
+  DateTime end;
+
+  _Window(this.parentSpan, this.span, this.end, this.timer);
+}
+
+class _Stats {
+  /// The summary span of these operations, if there is one per name.
+  final InstrumentationSpan? span;
+  DateTime end;
+  int count = 0;
+  int errors = 0;
+  int totalMicros = 0;
+  int maxMicros = 0;
+  int bytes = 0;
+  int? rows;
+  final histogram =
+      List<int>.filled(OperationAggregator.histogramBoundsMicros.length + 1, 0);
+
+  _Stats(this.span, this.end);
+
+  void add(int micros, {int? bytes, int? rows, required bool failed}) {
+    count++;
+    if (failed) {
+      errors++;
+    }
+    totalMicros += micros;
+    if (micros > maxMicros) {
+      maxMicros = micros;
+    }
+    if (bytes != null) {
+      this.bytes += bytes;
+    }
+    if (rows != null) {
+      this.rows = (this.rows ?? 0) + rows;
+    }
+    histogram[_bucketOf(micros)]++;
+  }
+
+  /// Writes the stats to [span] and returns whether any operation failed.
+  bool writeTo(InstrumentationSpan span, String prefix) {
+    span.setData('$prefix.count', count);
+    span.setData('$prefix.total_ms', totalMicros / 1000);
+    span.setData('$prefix.max_ms', maxMicros / 1000);
+    span.setData('$prefix.histogram', histogram);
+    if (bytes > 0) {
+      span.setData('$prefix.bytes', bytes);
+    }
+    final rows = this.rows;
+    if (rows != null) {
+      span.setData('$prefix.rows', rows);
+    }
+    if (errors > 0) {
+      span.setData('$prefix.errors', errors);
+    }
+    return errors > 0;
+  }
+
+  static int _bucketOf(int micros) {
+    const bounds = OperationAggregator.histogramBoundsMicros;
+    for (var i = 0; i < bounds.length; i++) {
+      if (micros < bounds[i]) {
+        return i;
+      }
+    }
+    return bounds.length;
+  }
+}
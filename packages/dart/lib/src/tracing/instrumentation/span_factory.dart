@@ -7,10 +7,13 @@ import '../../../sentry.dart';
 @internal
 abstract class InstrumentationSpanFactory {
   /// Returns `null` if span creation fails or if the parent span is no-op.
+  ///
+  /// The span starts now unless [startTimestamp] is given.
   InstrumentationSpan? createSpan({
     required InstrumentationSpan parentSpan,
     required String operation,
     String? description,
+    DateTime? startTimestamp,
   });
 
   /// Returns `null` if no active span or tracing disabled.
@@ -25,6 +28,7 @@ class LegacyInstrumentationSpanFactory implements InstrumentationSpanFactory {
     required InstrumentationSpan parentSpan,
     required String operation,
     String? description,
+    DateTime? startTimestamp,
   }) {
     if (parentSpan is LegacyInstrumentationSpan) {
       final parentSpanRef = parentSpan.spanReference;
@@ -33,6 +37,7 @@ class LegacyInstrumentationSpanFactory implements InstrumentationSpanFactory {
       final child = parentSpanRef.startChild(
         operation,
         description: description,
+        startTimestamp: startTimestamp,
       );
 
       if (child is NoOpSentrySpan) return null;
@@ -62,13 +67,14 @@ class StreamingInstrumentationSpanFactory
     required InstrumentationSpan parentSpan,
     required String operation,
     String? description,
+    DateTime? startTimestamp,
   }) {
     if (parentSpan is StreamingInstrumentationSpan) {
       final parentSpanRef = parentSpan.spanReference;
       if (parentSpanRef is NoOpSentrySpanV2) return null;
 
       final childSpan = _hub.startInactiveSpan(description ?? operation,
-          parentSpan: parentSpanRef);
+          parentSpan: parentSpanRef, startTimestamp: startTimestamp);
 
       if (childSpan is NoOpSentrySpanV2) return null;
 
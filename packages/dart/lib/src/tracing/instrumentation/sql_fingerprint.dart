@@ -0,0 +1,216 @@
+import 'package:meta/meta.dart';
+
+/// Normalizes SQL statements into fingerprints, so that statements which only
+/// differ in their literal values can be grouped, e.g. the queries of an N+1
+/// pattern.
+///
+/// String, blob and numeric literals as well as bind parameters are replaced
+/// with `?`, `IN` lists and repeated `VALUES` rows are collapsed into one,
+/// comments are removed and whitespace is collapsed. Identifiers and keywords
+/// are kept as they are.
+///
+/// Fingerprints are cached by statement, since apps run the same statements
+/// over and over again.
+@internal
+class SqlFingerprinter {
+  /// The fingerprinter used by the database integrations.
+  static final shared = SqlFingerprinter();
+
+  /// Statements longer than this are fingerprinted but not cached, so that
+  /// large generated statements don't pin their memory.
+  static const maxCachedLength = 4096;
+
+  /// Maximum number of cached fingerprints. The least recently used one is
+  /// evicted when the cache is full.
+  final int cacheSize;
+
+  // Map literals keep insertion order, which is used as the recency order.
+  final _cache = <String, String>{};
+
+  SqlFingerprinter({this.cacheSize = 256});
+
+  @visibleForTesting
+  int get cachedCount => _cache.length;
+
+  /// Returns the fingerprint of [sql].
+  String fingerprint(String sql) {
+    final cached = _cache.remove(sql);
+    if (cached != null) {
+      _cache[sql] = cached;
+      return cached;
+    }
+    final fingerprint = normalize(sql);
+    if (sql.length <= maxCachedLength && cacheSize > 0) {
+      if (_cache.length >= cacheSize) {
+        _cache.remove(_cache.keys.first);
+      }
+      _cache[sql] = fingerprint;
+    }
+    return fingerprint;
+  }
+
+  static final _inList = RegExp(
+    r'\b(IN)\s*\(\s*\?(?:\s*,\s*\?)*\s*\)',
+    caseSensitive: false,
+  );
+  static final _repeatedRows = RegExp(r'(\([?,\s]+\))(?:\s*,\s*\1)+');
+
+  /// Computes the fingerprint of [sql] without the cache.
+  static String normalize(String sql) {
+    final out = StringBuffer();
+    final length = sql.length;
+    var space = false;
+    var i = 0;
+
+    void write(String token) {
+      if (space && out.isNotEmpty) {
+        out.write(' ');
+      }
+      space = false;
+      out.write(token);
+    }
+
+    while (i < length) {
+      final c = sql.codeUnitAt(i);
+
+      if (_isSpace(c)) {
+        space = true;
+        i++;
+      } else if (c == _dash && _at(sql, i + 1) == _dash) {
+        i = _skipUntil(sql, i + 2, '\n');
+        space = true;
+      } else if (c == _slash && _at(sql, i + 1) == _star) {
+        i = _skipUntil(sql, i + 2, '*/');
+        space = true;
+      } else if (c == _quote) {
+        i = _skipQuoted(sql, i + 1, _quote);
+        write('?');
+      } else if (c == _doubleQuote || c == _backtick) {
+        final end = _skipQuoted(sql, i + 1, c);
+        write(sql.substring(i, end));
+        i = end;
+      } else if (c == _openBracket) {
+        final end = _skipUntil(sql, i + 1, ']');
+        write(sql.substring(i, end));
+        i = end;
+      } else if ((c | 0x20) == _x && _at(sql, i + 1) == _quote) {
+        i = _skipQuoted(sql, i + 2, _quote);
+        write('?');
+      } else if (_isDigit(c) || (c == _dot && _isDigit(_at(sql, i + 1)))) {
+        i = _skipNumber(sql, i);
+        write('?');
+      } else if (c == _question) {
+        i++;
+        while (_isDigit(_at(sql, i))) {
+          i++;
+        }
+        write('?');
+      } else if ((c == _colon || c == _atSign || c == _dollar) &&
+          _isIdentifierStart(_at(sql, i + 1))) {
+        i++;
+        while (_isIdentifierPart(_at(sql, i))) {
+          i++;
+        }
+        write('?');
+      } else if (_isIdentifierStart(c)) {
+        final start = i;
+        while (_isIdentifierPart(_at(sql, i))) {
+          i++;
+        }
+        write(sql.substring(start, i));
+      } else {
+        write(String.fromCharCode(c));
+        i++;
+      }
+    }
+
+    return out
+        .toString()
+        .replaceAllMapped(_inList, (match) => '${match[1]} (?)')
+        .replaceAllMapped(_repeatedRows, (match) => match[1]!);
+  }
+
+  static const _tab = 0x09;
+  static const _newline = 0x0A;
+  static const _carriageReturn = 0x0D;
+  static const _space = 0x20;
+  static const _doubleQuote = 0x22;
+  static const _dollar = 0x24;
+  static const _quote = 0x27;
+  static const _star = 0x2A;
+  static const _dash = 0x2D;
+  static const _dot = 0x2E;
+  static const _slash = 0x2F;
+  static const _colon = 0x3A;
+  static const _question = 0x3F;
+  static const _atSign = 0x40;
+  static const _openBracket = 0x5B;
+  static const _underscore = 0x5F;
+  static const _backtick = 0x60;
+  static const _x = 0x78;
+
+  static int _at(String sql, int index) =>
+      index < sql.length ? sql.codeUnitAt(index) : -1;
+
+  static bool _isSpace(int c) =>
+      c == _space || c == _newline || c == _tab || c == _carriageReturn;
+
+  static bool _isDigit(int c) => c >= 0x30 && c <= 0x39;
+
+  static bool _isIdentifierStart(int c) {
+    final lower = c | 0x20;
+    return (lower >= 0x61 && lower <= 0x7A) || c == _underscore || c > 0x7F;
+  }
+
+  static bool _isIdentifierPart(int c) =>
+      _isIdentifierStart(c) || _isDigit(c) || c == _dollar;
+
+  /// Returns the index after [end], or the end of [sql].
+  static int _skipUntil(String sql, int from, String end) {
+    final index = sql.indexOf(end, from);
+    return index < 0 ? sql.length : index + end.length;
+  }
+
+  /// Returns the index after the closing [quote], where two quotes in a row
+  /// are an escaped quote.
+  static int _skipQuoted(String sql, int from, int quote) {
+    var i = from;
+    while (i < sql.length) {
+      if (sql.codeUnitAt(i) == quote) {
+        if (_at(sql, i + 1) != quote) {
+          return i + 1;
+        }
+        i++;
+      }
+      i++;
+    }
+    return i;
+  }
+
+  /// Returns the index after the numeric literal at [from], including hex
+  /// literals, decimals and exponents.
+  static int _skipNumber(String sql, int from) {
+    var i = from;
+    if (sql.codeUnitAt(i) == 0x30 && (_at(sql, i + 1) | 0x20) == _x) {
+      i += 2;
+      while (_isIdentifierPart(_at(sql, i))) {
+        i++;
+      }
+      return i;
+    }
+    while (_isDigit(_at(sql, i)) || _at(sql, i) == _dot) {
+      i++;
+    }
+    if ((_at(sql, i) | 0x20) == 0x65) {
+      final sign = _at(sql, i + 1);
+      final exponent = sign == 0x2B || sign == _dash ? i + 2 : i + 1;
+      if (_isDigit(_at(sql, exponent))) {
+        i = exponent;
+        while (_isDigit(_at(sql, i))) {
+          i++;
+        }
+      }
+    }
+    return i;
+  }
+}
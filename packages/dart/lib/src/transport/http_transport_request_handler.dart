@@ -7,6 +7,7 @@ import 'noop_encode.dart' if (dart.library.io) 'encode.dart';
 import '../protocol.dart';
 import '../sentry_options.dart';
 import '../sentry_envelope.dart';
+import '../utils/sdk_overhead_stats.dart';
 
 @internal
 class HttpTransportRequestHandler {
@@ -31,8 +32,25 @@ class HttpTransportRequestHandler {
   Future<StreamedRequest> createRequest(SentryEnvelope envelope) async {
     final streamedRequest = StreamedRequest('POST', _requestUri);
 
-    if (_options.compressPayload) {
-      final compressionSink = compressInSink(streamedRequest.sink, _headers);
+    if (_options.envelopeWorkerCount > 0) {
+      // Only the snapshot is taken on this isolate, encoding and compression
+      // run in the worker pool.
+      final snapshot = await envelope.snapshot(_options);
+      final body = _options.compressPayload
+          ? await _options.workerPool.run(_encodeCompressed, snapshot)
+          : await _options.workerPool.run(_encode, snapshot);
+      if (_options.compressPayload) {
+        setGzipEncoding(_headers);
+      }
+      streamedRequest.sink
+        ..add(body)
+        ..close();
+    } else if (_options.compressPayload) {
+      var compressionSink = compressInSink(streamedRequest.sink, _headers);
+      if (_options.enableSdkOverheadStats) {
+        compressionSink =
+            _TimedSink(compressionSink, _options.sdkOverheadStats);
+      }
       envelope
           .envelopeStream(_options)
           .listen(compressionSink.add)
@@ -49,6 +67,37 @@ class HttpTransportRequestHandler {
   }
 }
 
+List<int> _encode(SentryEnvelopeSnapshot snapshot) => snapshot.encode();
+
+List<int> _encodeCompressed(SentryEnvelopeSnapshot snapshot) =>
+    compressBody(snapshot.encode(), {});
+
+/// Measures the time spent in [add] and [close] of a compressing sink,
+/// where the compression happens, and records it once the sink is closed.
+class _TimedSink implements Sink<List<int>> {
+  final Sink<List<int>> _sink;
+  final SdkOverheadStats _stats;
+  final Stopwatch _stopwatch = Stopwatch();
+
+  _TimedSink(this._sink, this._stats);
+
+  @override
+  void add(List<int> data) {
+    _stopwatch.start();
+    _sink.add(data);
+    _stopwatch.stop();
+  }
+
+  @override
+  void close() {
+    _stopwatch.start();
+    _sink.close();
+    _stopwatch.stop();
+    _stats.record(
+        SdkOverheadStage.compression, _stopwatch.elapsedMicroseconds);
+  }
+}
+
 Map<String, String> _buildHeaders(bool isWeb, String sdkIdentifier) {
   final headers = {'Content-Type': 'application/x-sentry-envelope'};
   // NOTE(lejard_h) overriding user agent on VM and Flutter not sure why
@@ -5,3 +5,6 @@ List<int> compressBody(List<int> body, Map<String, String> headers) => body;
 Sink<List<int>> compressInSink(
         Sink<List<int>> sink, Map<String, String> headers) =>
     sink;
+
+/// gzip compression is not available on browser
+void setGzipEncoding(Map<String, String> headers) {}
@@ -11,79 +11,64 @@ class RateLimiter {
   RateLimiter(this._options);
 
   final SentryOptions _options;
-  final _rateLimitedUntil = <DataCategory, DateTime>{};
+
+  /// Milliseconds since epoch until which each category is rate limited,
+  /// indexed by [DataCategory.index], or [_none].
+  final _rateLimitedUntil =
+      List<int>.filled(DataCategory.values.length, _none);
+
+  /// The latest deadline in [_rateLimitedUntil], [_none] once it has passed.
+  /// Until then nothing is rate limited, and [filter] doesn't even read the
+  /// clock.
+  int _latestDeadline = _none;
+
+  static const _none = -1;
 
   /// Filter out envelopes that are rate limited.
   SentryEnvelope? filter(SentryEnvelope envelope) {
-    // Optimize for/No allocations if no items are under 429
-    List<SentryEnvelopeItem>? dropItems;
-    for (final item in envelope.items) {
-      // using the raw value of the enum to not expose SentryEnvelopeItemType
-      if (_isRetryAfter(item.header.type)) {
-        dropItems ??= [];
-        dropItems.add(item);
-
-        final category = DataCategory.fromItemType(item.header.type);
-        if (category == DataCategory.logItem) {
-          TransportUtils.recordLostLogItem(
-            _options,
-            item,
-            DiscardReason.rateLimitBackoff,
-          );
-        } else if (category == DataCategory.metric) {
-          TransportUtils.recordLostMetricItem(
-            _options,
-            item,
-            DiscardReason.rateLimitBackoff,
-          );
-        } else {
-          _options.recorder.recordLostEvent(
-            DiscardReason.rateLimitBackoff,
-            category,
-          );
-        }
-        internalLogger.warning(
-          'Envelope item of type "${item.header.type}" was dropped due to rate limiting.',
-        );
-
-        final originalObject = item.originalObject;
-        if (originalObject is SentryTransaction) {
-          _options.recorder.recordLostEvent(
-            DiscardReason.rateLimitBackoff,
-            DataCategory.span,
-            count: originalObject.spans.length + 1,
-          );
-        }
-      }
+    if (_latestDeadline == _none) {
+      return envelope;
+    }
+    final now = _options.clock().millisecondsSinceEpoch;
+    if (now > _latestDeadline) {
+      // All limits have expired.
+      _rateLimitedUntil.fillRange(0, _rateLimitedUntil.length, _none);
+      _latestDeadline = _none;
+      return envelope;
     }
 
-    if (dropItems != null) {
-      // Need a new envelope
-      final toSend = <SentryEnvelopeItem>[];
-      for (final item in envelope.items) {
-        if (!dropItems.contains(item)) {
-          toSend.add(item);
-        }
-      }
-
-      // no reason to continue
-      if (toSend.isEmpty) {
-        internalLogger.warning(
-          'Envelope was dropped due to rate limiting.',
-        );
-        return null;
+    // Only allocates once the first item to drop is found.
+    List<SentryEnvelopeItem>? toSend;
+    final items = envelope.items;
+    for (var i = 0; i < items.length; i++) {
+      final item = items[i];
+      // using the raw value of the enum to not expose SentryEnvelopeItemType
+      final category = DataCategory.fromItemType(item.header.type);
+      if (!_isRetryAfter(category, now)) {
+        toSend?.add(item);
+        continue;
       }
+      toSend ??= items.sublist(0, i);
+      _recordDropped(item, category);
+    }
 
-      return SentryEnvelope(envelope.header, toSend);
-    } else {
+    if (toSend == null) {
       return envelope;
     }
+    // no reason to continue
+    if (toSend.isEmpty) {
+      internalLogger.warning(
+        'Envelope was dropped due to rate limiting.',
+      );
+      return null;
+    }
+    // Need a new envelope
+    return SentryEnvelope(envelope.header, toSend);
   }
 
   /// Update rate limited categories
   void updateRetryAfterLimits(
       String? sentryRateLimitHeader, String? retryAfterHeader, int errorCode) {
-    final currentDateTime = _options.clock().millisecondsSinceEpoch;
     var rateLimits = <RateLimit>[];
 
     if (sentryRateLimitHeader != null) {
@@ -92,7 +77,11 @@ class RateLimiter {
     } else if (errorCode == 429) {
       rateLimits = RateLimitParser(retryAfterHeader).parseRetryAfterHeader();
     }
+    if (rateLimits.isEmpty) {
+      return;
+    }
 
+    final currentDateTime = _options.clock().millisecondsSinceEpoch;
     for (final rateLimit in rateLimits) {
       if (rateLimit.category == DataCategory.metricBucket &&
           rateLimit.namespaces.isNotEmpty &&
@@ -101,25 +90,20 @@ class RateLimiter {
       }
       _applyRetryAfterOnlyIfLonger(
         rateLimit.category,
-        DateTime.fromMillisecondsSinceEpoch(
-            currentDateTime + rateLimit.duration.inMilliseconds),
+        currentDateTime + rateLimit.duration.inMilliseconds,
       );
     }
   }
 
   // Private
 
-  bool _isRetryAfter(String itemType) {
-    final dataCategory = DataCategory.fromItemType(itemType);
-    final currentDate = DateTime.fromMillisecondsSinceEpoch(
-        _options.clock().millisecondsSinceEpoch);
+  bool _isLimited(DataCategory category, int now) =>
+      now <= _rateLimitedUntil[category.index];
 
+  bool _isRetryAfter(DataCategory dataCategory, int now) {
     // check all categories
-    final dateAllCategories = _rateLimitedUntil[DataCategory.all];
-    if (dateAllCategories != null) {
-      if (!currentDate.isAfter(dateAllCategories)) {
-        return true;
-      }
+    if (_isLimited(DataCategory.all, now)) {
+      return true;
     }
 
     // Unknown should not be rate limited
@@ -128,8 +112,7 @@ class RateLimiter {
     }
 
     // check for specific dataCategory
-    final dateCategory = _rateLimitedUntil[dataCategory];
-    if (dateCategory != null && !currentDate.isAfter(dateCategory)) {
+    if (_isLimited(dataCategory, now)) {
       return true;
     }
 
@@ -137,30 +120,58 @@ class RateLimiter {
     // documented as "apply to logs"), but log envelope items only map to
     // `logItem`. Honor a `log_byte` limit here so log items are dropped too.
     if (dataCategory == DataCategory.logItem) {
-      final dateLogByte = _rateLimitedUntil[DataCategory.logByte];
-      if (dateLogByte != null && !currentDate.isAfter(dateLogByte)) {
-        return true;
-      }
+      return _isLimited(DataCategory.logByte, now);
     }
 
     // Metric envelope items map to `metric`, but Relay can rate limit their
     // byte category independently. Honor that limit for metric items too.
     if (dataCategory == DataCategory.metric) {
-      final dateMetricByte = _rateLimitedUntil[DataCategory.metricByte];
-      if (dateMetricByte != null && !currentDate.isAfter(dateMetricByte)) {
-        return true;
-      }
+      return _isLimited(DataCategory.metricByte, now);
     }
 
     return false;
   }
 
-  void _applyRetryAfterOnlyIfLonger(DataCategory dataCategory, DateTime date) {
-    final oldDate = _rateLimitedUntil[dataCategory];
+  void _recordDropped(SentryEnvelopeItem item, DataCategory category) {
+    if (category == DataCategory.logItem) {
+      TransportUtils.recordLostLogItem(
+        _options,
+        item,
+        DiscardReason.rateLimitBackoff,
+      );
+    } else if (category == DataCategory.metric) {
+      TransportUtils.recordLostMetricItem(
+        _options,
+        item,
+        DiscardReason.rateLimitBackoff,
+      );
+    } else {
+      _options.recorder.recordLostEvent(
+        DiscardReason.rateLimitBackoff,
+        category,
+      );
+    }
+    internalLogger.warning(
+      'Envelope item of type "${item.header.type}" was dropped due to rate limiting.',
+    );
+
+    final originalObject = item.originalObject;
+    if (originalObject is SentryTransaction) {
+      _options.recorder.recordLostEvent(
+        DiscardReason.rateLimitBackoff,
+        DataCategory.span,
+        count: originalObject.spans.length + 1,
+      );
+    }
+  }
 
-    // only overwrite its previous date if the limit is even longer
-    if (oldDate == null || date.isAfter(oldDate)) {
-      _rateLimitedUntil[dataCategory] = date;
+  void _applyRetryAfterOnlyIfLonger(DataCategory dataCategory, int deadline) {
+    // only overwrite its previous deadline if the limit is even longer
+    if (deadline > _rateLimitedUntil[dataCategory.index]) {
+      _rateLimitedUntil[dataCategory.index] = deadline;
+    }
+    if (deadline > _latestDeadline) {
+      _latestDeadline = deadline;
     }
   }
 }
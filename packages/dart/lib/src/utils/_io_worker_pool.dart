@@ -0,0 +1,275 @@
+import 'dart:async';
+import 'dart:isolate';
+import 'dart:typed_data';
+
+import 'internal_logger.dart';
+import 'worker_pool.dart';
+
+WorkerPool createWorkerPool(int size, int maxQueuedPerWorker) =>
+    _IsolateWorkerPool(size, maxQueuedPerWorker);
+
+class _IsolateWorkerPool implements WorkerPool {
+  static const _minSpawnBackoff = Duration(seconds: 1);
+  static const _maxSpawnBackoff = Duration(minutes: 5);
+
+  final int _size;
+  final int _maxQueuedPerWorker;
+  final List<_Worker> _workers = [];
+  Future<_Worker?>? _spawning;
+  bool _closed = false;
+
+  // After a failed spawn, no worker is spawned for [_spawnBackoff], which
+  // doubles with every failure in a row.
+  final _spawnBackoffStopwatch = Stopwatch();
+  Duration _spawnBackoff = Duration.zero;
+
+  _IsolateWorkerPool(this._size, this._maxQueuedPerWorker);
+
+  bool get _canSpawn =>
+      _workers.length < _size &&
+      (!_spawnBackoffStopwatch.isRunning ||
+          _spawnBackoffStopwatch.elapsed >= _spawnBackoff);
+
+  @override
+  Future<Uint8List> run<M>(WorkerTask<M> task, M message) async {
+    final worker = await _acquire();
+    if (worker == null) {
+      return runInline(task, message);
+    }
+    final job = _Job<M>(task, message);
+    try {
+      worker.submit(job);
+    } catch (error) {
+      // The message references objects that cannot cross isolates, or the
+      // worker was stopped since it was acquired.
+      internalLogger.debug(
+        '$WorkerPool: Running task inline, it cannot be submitted: $error',
+      );
+      return runInline(task, message);
+    }
+    return job.completer.future;
+  }
+
+  /// Returns an idle worker, spawning one if the pool is not full yet, or
+  /// the least busy worker with room in its queue.
+  ///
+  /// The returned worker is reserved for the caller, so that callers that
+  /// waited for the same spawn are spread across the workers and queues.
+  Future<_Worker?> _acquire() async {
+    while (!_closed) {
+      _Worker? leastBusy;
+      for (final worker in _workers) {
+        if (leastBusy == null || worker.pending < leastBusy.pending) {
+          leastBusy = worker;
+        }
+      }
+      if (leastBusy != null && leastBusy.pending == 0) {
+        return leastBusy..reserve();
+      }
+      if (_canSpawn) {
+        // Concurrent callers share the spawn and select again afterwards.
+        await (_spawning ??= _spawn().whenComplete(() => _spawning = null));
+        continue;
+      }
+      if (leastBusy != null && leastBusy.pending < _maxQueuedPerWorker) {
+        return leastBusy..reserve();
+      }
+      break;
+    }
+    return null;
+  }
+
+  Future<_Worker?> _spawn() async {
+    final port = ReceivePort();
+    final ready = Completer<SendPort?>();
+    _Worker? worker;
+    port.listen((Object? message) {
+      if (message is SendPort) {
+        ready.complete(message);
+      } else if (message is _Result) {
+        worker?.complete(message);
+      } else if (message == null) {
+        // Sent by the isolate's exit listener.
+        if (!ready.isCompleted) {
+          ready.complete(null);
+        } else if (worker != null) {
+          _retire(worker!);
+        }
+      }
+    });
+
+    try {
+      final isolate = await Isolate.spawn(
+        _workerMain,
+        port.sendPort,
+        onExit: port.sendPort,
+        debugName: 'SentryWorkerPool',
+      );
+      final sendPort = await ready.future;
+      if (sendPort == null) {
+        throw StateError('Worker exited during startup');
+      }
+      final spawned = _Worker(isolate, port, sendPort);
+      if (_closed) {
+        spawned.stop();
+        return null;
+      }
+      _workers.add(spawned);
+      _spawnBackoffStopwatch
+        ..stop()
+        ..reset();
+      _spawnBackoff = Duration.zero;
+      return worker = spawned;
+    } catch (error, stackTrace) {
+      port.close();
+      _spawnBackoff = _spawnBackoff == Duration.zero
+          ? _minSpawnBackoff
+          : _spawnBackoff * 2;
+      if (_spawnBackoff > _maxSpawnBackoff) {
+        _spawnBackoff = _maxSpawnBackoff;
+      }
+      _spawnBackoffStopwatch
+        ..reset()
+        ..start();
+      internalLogger.warning(
+        '$WorkerPool: Failed to spawn worker, running tasks inline '
+        'for $_spawnBackoff',
+        error: error,
+        stackTrace: stackTrace,
+      );
+      return null;
+    }
+  }
+
+  void _retire(_Worker worker) {
+    _workers.remove(worker);
+    worker.stop();
+  }
+
+  @override
+  Future<void> close() async {
+    _closed = true;
+    for (final worker in List.of(_workers)) {
+      _retire(worker);
+    }
+  }
+}
+
+class _Worker {
+  final Isolate _isolate;
+  final ReceivePort _port;
+  final SendPort _sendPort;
+  final Map<int, _Job<dynamic>> _jobs = {};
+  int _nextId = 0;
+
+  // Callers that acquired this worker but did not submit their job yet.
+  int _reserved = 0;
+  bool _stopped = false;
+
+  _Worker(this._isolate, this._port, this._sendPort);
+
+  int get pending => _jobs.length + _reserved;
+
+  void reserve() => _reserved++;
+
+  /// Submits [job] in place of a reservation made with [reserve].
+  void submit(_Job<dynamic> job) {
+    _reserved--;
+    if (_stopped) {
+      throw StateError('Worker was stopped');
+    }
+    final id = _nextId++;
+    // Throws synchronously if the message cannot be sent.
+    _sendPort.send(job.toRequest(id));
+    _jobs[id] = job;
+  }
+
+  void complete(_Result result) {
+    final job = _jobs.remove(result.id);
+    if (job == null) {
+      return;
+    }
+    final bytes = result.bytes;
+    if (bytes != null) {
+      job.completer.complete(bytes.materialize().asUint8List());
+    } else {
+      job.completer.completeError(
+        RemoteError(result.error ?? 'Unknown error', result.stackTrace ?? ''),
+      );
+    }
+  }
+
+  /// Kills the isolate and runs the tasks it did not finish inline.
+  void stop() {
+    _stopped = true;
+    _isolate.kill(priority: Isolate.immediate);
+    _port.close();
+    final jobs = List.of(_jobs.values);
+    _jobs.clear();
+    for (final job in jobs) {
+      job.completeInline();
+    }
+  }
+}
+
+class _Job<M> {
+  final WorkerTask<M> task;
+  final M message;
+  final completer = Completer<Uint8List>();
+
+  _Job(this.task, this.message);
+
+  _Request<M> toRequest(int id) => _Request(id, task, message);
+
+  void completeInline() {
+    try {
+      completer.complete(runInline(task, message));
+    } catch (error, stackTrace) {
+      completer.completeError(error, stackTrace);
+    }
+  }
+}
+
+class _Request<M> {
+  final int id;
+  final WorkerTask<M> task;
+  final M message;
+
+  _Request(this.id, this.task, this.message);
+
+  List<int> run() => task(message);
+}
+
+class _Result {
+  final int id;
+  final TransferableTypedData? bytes;
+  final String? error;
+  final String? stackTrace;
+
+  _Result(this.id, {this.bytes, this.error, this.stackTrace});
+}
+
+void _workerMain(SendPort host) {
+  final port = RawReceivePort();
+  port.handler = (Object? message) {
+    final request = message as _Request<dynamic>;
+    _Result result;
+    try {
+      final bytes = request.run();
+      result = _Result(
+        request.id,
+        bytes: TransferableTypedData.fromList(
+          [bytes is Uint8List ? bytes : Uint8List.fromList(bytes)],
+        ),
+      );
+    } catch (error, stackTrace) {
+      result = _Result(
+        request.id,
+        error: error.toString(),
+        stackTrace: stackTrace.toString(),
+      );
+    }
+    host.send(result);
+  };
+  host.send(port.sendPort);
+}
@@ -0,0 +1,5 @@
+import 'worker_pool.dart';
+
+/// Isolates are not available on the web, so tasks always run inline.
+WorkerPool createWorkerPool(int size, int maxQueuedPerWorker) =>
+    const InlineWorkerPool();
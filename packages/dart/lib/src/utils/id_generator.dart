@@ -0,0 +1,112 @@
+import 'dart:math';
+import 'dart:typed_data';
+
+import 'package:meta/meta.dart';
+
+/// Generates random trace, event and span IDs from a pooled block of
+/// random words.
+///
+/// The pool is refilled in one go by a xoshiro128** generator that is
+/// re-seeded from [Random.secure] on every refill, so creating an ID is a
+/// couple of array reads instead of a UUID v4 generation and formatting.
+///
+/// All arithmetic is kept within 32 bits so the generator behaves the same
+/// on the Dart VM and on the web.
+@internal
+class IdGenerator {
+  IdGenerator._();
+
+  static const _poolSize = 512;
+  static const _mask32 = 0xFFFFFFFF;
+  static const _wordRange = 0x100000000;
+
+  static final Random _seedSource = _createSeedSource();
+  static final Uint32List _pool = Uint32List(_poolSize);
+  static int _position = _poolSize;
+
+  /// Returns the next random 32-bit word from the pool.
+  static int nextWord() {
+    if (_position == _poolSize) {
+      _refill();
+    }
+    return _pool[_position++];
+  }
+
+  /// Returns the next random 32-bit word that is guaranteed to be non-zero.
+  ///
+  /// Used for the leading word of an ID so that a generated ID can never
+  /// collide with the empty (all zero) ID.
+  static int nextNonZeroWord() {
+    var word = nextWord();
+    while (word == 0) {
+      word = nextWord();
+    }
+    return word;
+  }
+
+  static void _refill() {
+    var s0 = _seedSource.nextInt(_wordRange);
+    var s1 = _seedSource.nextInt(_wordRange);
+    var s2 = _seedSource.nextInt(_wordRange);
+    var s3 = _seedSource.nextInt(_wordRange);
+    if ((s0 | s1 | s2 | s3) == 0) {
+      s0 = 1;
+    }
+
+    for (var i = 0; i < _poolSize; i++) {
+      // xoshiro128**: result = rotl(s1 * 5, 7) * 9
+      final x = (s1 * 5) & _mask32;
+      _pool[i] = (_rotl(x, 7) * 9) & _mask32;
+
+      final t = (s1 << 9) & _mask32;
+      s2 ^= s0;
+      s3 ^= s1;
+      s1 ^= s2;
+      s0 ^= s3;
+      s2 ^= t;
+      s3 = _rotl(s3, 11);
+    }
+    _position = 0;
+  }
+
+  static int _rotl(int x, int k) =>
+      ((x << k) & _mask32) | ((x & _mask32) >> (32 - k));
+
+  static Random _createSeedSource() {
+    try {
+      return Random.secure();
+    } on UnsupportedError {
+      // Environments without a secure source of randomness.
+      return Random();
+    }
+  }
+
+  static const _hexDigits = '0123456789abcdef';
+
+  /// Formats [word] as 8 lowercase hex characters into [buffer] at [offset].
+  static void writeHexWord(List<int> buffer, int offset, int word) {
+    for (var i = 7; i >= 0; i--) {
+      buffer[offset + i] = _hexDigits.codeUnitAt(word & 0xF);
+      word >>= 4;
+    }
+  }
+
+  /// Parses 8 hex characters of [hex] starting at [offset] into a 32-bit
+  /// word. Returns `null` if any character is not a lowercase hex digit.
+  static int? parseHexWord(String hex, int offset) {
+    var word = 0;
+    for (var i = offset; i < offset + 8; i++) {
+      final c = hex.codeUnitAt(i);
+      final int digit;
+      if (c >= 0x30 && c <= 0x39) {
+        digit = c - 0x30; // 0-9
+      } else if (c >= 0x61 && c <= 0x66) {
+        digit = c - 0x61 + 10; // a-f
+      } else {
+        return null;
+      }
+      word = (word << 4) | digit;
+    }
+    return word;
+  }
+}
@@ -0,0 +1,219 @@
+import 'dart:developer';
+import 'dart:typed_data';
+
+import 'package:meta/meta.dart';
+
+import '../sentry_options.dart';
+
+/// Stages of the SDK whose own overhead is measured by [SdkOverheadStats].
+enum SdkOverheadStage {
+  /// Running the global and scope event processors.
+  eventProcessors('event_processors'),
+
+  /// Running `beforeSend`, `beforeSendTransaction` or `beforeSendFeedback`.
+  beforeSend('before_send'),
+
+  /// Encoding envelope headers and item payloads.
+  serialization('serialization'),
+
+  /// Compressing envelopes before they are sent.
+  compression('compression'),
+
+  /// Syncing scope changes to the native SDKs.
+  scopeSync('scope_sync'),
+
+  /// Encoding logs, metrics and spans into the telemetry buffers.
+  telemetryEncoding('telemetry_encoding'),
+
+  /// Capturing and masking screenshots.
+  screenshot('screenshot');
+
+  const SdkOverheadStage(this.key);
+
+  /// Name used in Timeline events and in [SdkOverheadStageStats.toJson].
+  final String key;
+}
+
+/// Measures how much time the SDK itself spends in the [SdkOverheadStage]s.
+///
+/// Disabled unless [SentryOptions.enableSdkOverheadStats] is set, in which
+/// case [start] returns `null` and costs a single field read. When enabled,
+/// durations are taken from a monotonic clock and recorded per stage into a
+/// count, a total, a maximum and a log2 histogram of fixed size, so memory
+/// does not grow with the number of measurements. Every measurement is also
+/// emitted as a Timeline event.
+///
+/// Read the stats with [snapshot], e.g. to export them as metrics of the
+/// app:
+///
+/// ```dart
+/// for (final stats in Sentry.currentHub.options.sdkOverheadStats.snapshot()) {
+///   print('${stats.stage.key}: ${stats.count}x, p95 ${stats.percentileMicros(0.95)}us');
+/// }
+/// ```
+class SdkOverheadStats {
+  /// Number of histogram buckets. Bucket `i` counts durations of less than
+  /// `2^i` microseconds, the last one also counts everything longer.
+  static const bucketCount = 24;
+
+  static final Stopwatch _clock = Stopwatch()..start();
+
+  final SentryOptions _options;
+
+  // One row of [_fieldsPerStage] values per stage. Kept as doubles because
+  // 64-bit integer lists are not available on the web.
+  static const _fieldsPerStage = 3 + bucketCount;
+  static const _countField = 0;
+  static const _totalField = 1;
+  static const _maxField = 2;
+  final Float64List _data =
+      Float64List(SdkOverheadStage.values.length * _fieldsPerStage);
+
+  @internal
+  SdkOverheadStats(this._options);
+
+  /// Starts measuring [stage]. Returns `null` if stats are disabled.
+  @internal
+  SdkOverheadTimer? start(SdkOverheadStage stage) {
+    if (!_options.enableSdkOverheadStats) {
+      return null;
+    }
+    return SdkOverheadTimer._(this, stage, _clock.elapsedMicroseconds);
+  }
+
+  /// Measures the synchronous [action] as [stage].
+  @internal
+  T measure<T>(SdkOverheadStage stage, T Function() action) {
+    final timer = start(stage);
+    try {
+      return action();
+    } finally {
+      timer?.stop();
+    }
+  }
+
+  /// Records a measurement of [micros] microseconds for [stage].
+  @internal
+  void record(SdkOverheadStage stage, int micros) {
+    if (!_options.enableSdkOverheadStats) {
+      return;
+    }
+    final row = stage.index * _fieldsPerStage;
+    _data[row + _countField] += 1;
+    _data[row + _totalField] += micros;
+    if (micros > _data[row + _maxField]) {
+      _data[row + _maxField] = micros.toDouble();
+    }
+    _data[row + 3 + _bucketOf(micros)] += 1;
+  }
+
+  /// Returns a copy of the stats of all stages that were measured at least
+  /// once since the start or the last [reset].
+  List<SdkOverheadStageStats> snapshot() {
+    final stats = <SdkOverheadStageStats>[];
+    for (final stage in SdkOverheadStage.values) {
+      final row = stage.index * _fieldsPerStage;
+      final count = _data[row + _countField].toInt();
+      if (count == 0) {
+        continue;
+      }
+      stats.add(SdkOverheadStageStats._(
+        stage,
+        count: count,
+        totalMicros: _data[row + _totalField].toInt(),
+        maxMicros: _data[row + _maxField].toInt(),
+        buckets: List.unmodifiable(_data
+            .sublist(row + 3, row + _fieldsPerStage)
+            .map((value) => value.toInt())),
+      ));
+    }
+    return stats;
+  }
+
+  /// Clears all recorded measurements.
+  void reset() => _data.fillRange(0, _data.length, 0);
+
+  static int _bucketOf(int micros) {
+    if (micros <= 0) {
+      return 0;
+    }
+    final bucket = micros.bitLength;
+    return bucket < bucketCount ? bucket : bucketCount - 1;
+  }
+}
+
+/// A running measurement of a [SdkOverheadStage], see
+/// [SdkOverheadStats.start].
+@internal
+class SdkOverheadTimer {
+  final SdkOverheadStats _stats;
+  final SdkOverheadStage stage;
+  final int _startMicros;
+  final TimelineTask _task;
+
+  SdkOverheadTimer._(this._stats, this.stage, this._startMicros)
+      : _task = TimelineTask()..start('Sentry::overhead:${stage.key}');
+
+  /// Stops the measurement and records it.
+  void stop() {
+    _task.finish();
+    _stats.record(
+      stage,
+      SdkOverheadStats._clock.elapsedMicroseconds - _startMicros,
+    );
+  }
+}
+
+/// Stats of a single [SdkOverheadStage], see [SdkOverheadStats.snapshot].
+class SdkOverheadStageStats {
+  final SdkOverheadStage stage;
+
+  /// Number of measurements.
+  final int count;
+
+  /// Sum of all measurements in microseconds.
+  final int totalMicros;
+
+  /// Longest measurement in microseconds.
+  final int maxMicros;
+
+  /// Counts per histogram bucket, see [SdkOverheadStats.bucketCount].
+  final List<int> buckets;
+
+  SdkOverheadStageStats._(
+    this.stage, {
+    required this.count,
+    required this.totalMicros,
+    required this.maxMicros,
+    required this.buckets,
+  });
+
+  /// Mean of the measurements in microseconds.
+  double get meanMicros => totalMicros / count;
+
+  /// Upper bound of the bucket that contains the [percentile] (0 to 1) of
+  /// all measurements, capped at [maxMicros].
+  int percentileMicros(double percentile) {
+    assert(percentile >= 0 && percentile <= 1);
+    final target = (count * percentile).ceil();
+    var seen = 0;
+    for (var i = 0; i < buckets.length; i++) {
+      seen += buckets[i];
+      if (seen >= target && seen > 0) {
+        final upperBound = 1 << i;
+        return upperBound < maxMicros ? upperBound : maxMicros;
+      }
+    }
+    return maxMicros;
+  }
+
+  Map<String, dynamic> toJson() => {
+        'stage': stage.key,
+        'count': count,
+        'total_us': totalMicros,
+        'max_us': maxMicros,
+        'p50_us': percentileMicros(0.5),
+        'p95_us': percentileMicros(0.95),
+        'p99_us': percentileMicros(0.99),
+      };
+}
@@ -0,0 +1,59 @@
+import 'dart:async';
+import 'dart:typed_data';
+
+import 'package:meta/meta.dart';
+
+import '_io_worker_pool.dart'
+    if (dart.library.js_interop) '_web_worker_pool.dart' as worker_pool_impl;
+
+/// A task run by a [WorkerPool].
+///
+/// Tasks are sent to other isolates, so they must be top-level or static
+/// functions and their messages must be sendable.
+typedef WorkerTask<M> = List<int> Function(M message);
+
+/// Runs byte producing tasks, such as encoding and compressing envelopes,
+/// off the calling isolate.
+///
+/// On the Dart VM, up to `size` worker isolates are spawned on demand. Each
+/// worker accepts at most `maxQueuedPerWorker` tasks at a time and results
+/// are sent back as [TransferableTypedData], so they are not copied again.
+///
+/// Whenever a task cannot be handed to a worker, it runs inline on the
+/// calling isolate instead: on the web, when the pool is closed or all
+/// queues are full, when a worker cannot be spawned or exits, and when the
+/// message cannot be sent to another isolate.
+@internal
+abstract class WorkerPool {
+  factory WorkerPool({required int size, int maxQueuedPerWorker = 8}) {
+    if (size <= 0) {
+      return const InlineWorkerPool();
+    }
+    return worker_pool_impl.createWorkerPool(size, maxQueuedPerWorker);
+  }
+
+  /// Runs [task] with [message] and returns the produced bytes.
+  Future<Uint8List> run<M>(WorkerTask<M> task, M message);
+
+  /// Stops all workers. Tasks that are still queued are run inline.
+  Future<void> close();
+}
+
+/// A [WorkerPool] that runs every task on the calling isolate.
+@internal
+class InlineWorkerPool implements WorkerPool {
+  const InlineWorkerPool();
+
+  @override
+  Future<Uint8List> run<M>(WorkerTask<M> task, M message) async =>
+      runInline(task, message);
+
+  @override
+  Future<void> close() async {}
+}
+
+@internal
+Uint8List runInline<M>(WorkerTask<M> task, M message) {
+  final result = task(message);
+  return result is Uint8List ? result : Uint8List.fromList(result);
+}
@@ -103,6 +103,27 @@ void main() {
       expect(metricByte?.toJson()['category'], 'trace_metric_byte');
     });
 
+    test('flush returns outcomes of every recorded reason and category', () {
+      final sut = fixture.getSut();
+
+      for (final reason in DiscardReason.values) {
+        for (final category in DataCategory.values) {
+          sut.recordLostEvent(reason, category, count: 2);
+        }
+      }
+
+      final clientReport = sut.flush();
+
+      expect(
+        clientReport?.discardedEvents,
+        hasLength(DiscardReason.values.length * DataCategory.values.length),
+      );
+      expect(
+        clientReport?.discardedEvents.every((event) => event.quantity == 2),
+        true,
+      );
+    });
+
     test('calling flush multiple times returns null', () {
       final sut = fixture.getSut();
 
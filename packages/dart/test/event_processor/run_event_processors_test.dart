@@ -0,0 +1,158 @@
+import 'package:sentry/sentry.dart';
+import 'package:sentry/src/client_reports/discard_reason.dart';
+import 'package:sentry/src/event_processor/run_event_processors.dart';
+import 'package:sentry/src/transport/data_category.dart';
+import 'package:test/test.dart';
+
+import '../mocks.dart';
+import '../mocks/mock_client_report_recorder.dart';
+import '../test_utils.dart';
+
+void main() {
+  group('runEventProcessors', () {
+    late SentryOptions options;
+    late MockClientReportRecorder recorder;
+
+    setUp(() {
+      recorder = MockClientReportRecorder();
+      options = defaultTestOptions()..recorder = recorder;
+    });
+
+    test('returns synchronously when all processors are sync', () {
+      final event = SentryEvent();
+      final result = runEventProcessors(
+        event,
+        Hint(),
+        [
+          FunctionEventProcessor((event, hint) => event..tags = {'a': '1'}),
+          FunctionEventProcessor(
+              (event, hint) => event..level = SentryLevel.info),
+        ],
+        options,
+      );
+
+      expect(result, isNot(isA<Future>()));
+      expect((result as SentryEvent).tags, {'a': '1'});
+      expect(result.level, SentryLevel.info);
+    });
+
+    test('continues async once a processor returns a future', () async {
+      final calls = <String>[];
+      final result = runEventProcessors(
+        SentryEvent(),
+        Hint(),
+        [
+          FunctionEventProcessor((event, hint) {
+            calls.add('sync');
+            return event;
+          }),
+          _AsyncEventProcessor((event) {
+            calls.add('async');
+            return event..tags = {'a': '1'};
+          }),
+          FunctionEventProcessor((event, hint) {
+            calls.add('after');
+            return event..level = SentryLevel.info;
+          }),
+        ],
+        options,
+      );
+
+      expect(result, isA<Future<SentryEvent?>>());
+      expect(calls, ['sync']);
+
+      final event = await result;
+      expect(calls, ['sync', 'async', 'after']);
+      expect(event?.tags, {'a': '1'});
+      expect(event?.level, SentryLevel.info);
+    });
+
+    test('stops and records the drop when a sync processor drops', () {
+      var called = false;
+      final result = runEventProcessors(
+        SentryEvent(),
+        Hint(),
+        [
+          DropAllEventProcessor(),
+          FunctionEventProcessor((event, hint) {
+            called = true;
+            return event;
+          }),
+        ],
+        options,
+      );
+
+      expect(result, isNull);
+      expect(called, isFalse);
+      expect(recorder.discardedEvents.single.reason,
+          DiscardReason.eventProcessor);
+      expect(recorder.discardedEvents.single.category, DataCategory.error);
+    });
+
+    test('stops and records the drop when an async processor drops',
+        () async {
+      var called = false;
+      final result = await runEventProcessors(
+        SentryEvent(),
+        Hint(),
+        [
+          _AsyncEventProcessor((event) => null),
+          FunctionEventProcessor((event, hint) {
+            called = true;
+            return event;
+          }),
+        ],
+        options,
+      );
+
+      expect(result, isNull);
+      expect(called, isFalse);
+      expect(recorder.discardedEvents.single.reason,
+          DiscardReason.eventProcessor);
+    });
+
+    test('keeps the event if a processor throws', () {
+      options.automatedTestMode = false;
+      final event = SentryEvent();
+
+      final result = runEventProcessors(
+        event,
+        Hint(),
+        [
+          FunctionEventProcessor((event, hint) => throw StateError('fixture')),
+        ],
+        options,
+      );
+
+      expect(result, same(event));
+    });
+
+    test('keeps the event if an async processor throws', () async {
+      options.automatedTestMode = false;
+      final event = SentryEvent();
+
+      final result = await runEventProcessors(
+        event,
+        Hint(),
+        [
+          _AsyncEventProcessor((event) => throw StateError('fixture')),
+        ],
+        options,
+      );
+
+      expect(result, same(event));
+    });
+  });
+}
+
+class _AsyncEventProcessor implements EventProcessor {
+  _AsyncEventProcessor(this.applyFunction);
+
+  final SentryEvent? Function(SentryEvent event) applyFunction;
+
+  @override
+  Future<SentryEvent?> apply(SentryEvent event, Hint hint) async {
+    await Future<void>.delayed(Duration.zero);
+    return applyFunction(event);
+  }
+}
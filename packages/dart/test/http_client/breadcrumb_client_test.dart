@@ -1,5 +1,6 @@
 // ignore_for_file: invalid_use_of_internal_member
 
+import 'dart:async';
 import 'dart:io';
 
 import 'package:_sentry_testing/_sentry_testing.dart';
@@ -278,6 +279,42 @@ void main() {
       expect(breadcrumb.data?['response'], isA<Map>());
     });
 
+    test('adds the breadcrumb once the response body is captured', () async {
+      final bodyCaptured = Completer<void>();
+      final capture = FakeNetworkDetailsCapture(bodyCaptured: bodyCaptured);
+
+      final sut = fixture.getSut(
+        fixture.getClient(statusCode: 200, reason: 'OK'),
+        capture,
+      );
+
+      await sut.get(requestUri);
+      expect(fixture.hub.addBreadcrumbCalls, isEmpty);
+
+      bodyCaptured.complete();
+      await pumpEventQueue();
+
+      final breadcrumb = fixture.hub.addBreadcrumbCalls.single.crumb;
+      expect((breadcrumb.data?['response'] as Map)['body'], 'captured');
+    });
+
+    test('adds the breadcrumb if the body capture fails', () async {
+      final bodyCaptured = Completer<void>();
+      final capture = FakeNetworkDetailsCapture(bodyCaptured: bodyCaptured);
+
+      final sut = fixture.getSut(
+        fixture.getClient(statusCode: 200, reason: 'OK'),
+        capture,
+      );
+
+      await sut.get(requestUri);
+      bodyCaptured.completeError(Exception('stream failed'));
+      await pumpEventQueue();
+
+      final breadcrumb = fixture.hub.addBreadcrumbCalls.single.crumb;
+      expect((breadcrumb.data?['response'] as Map)['body'], isNull);
+    });
+
     test(
         'captures request headers as mutated by a wrapped client during '
         'send (e.g. tracing headers added after dispatch)', () async {
@@ -433,12 +470,14 @@ class FakeNetworkDetailsCapture implements NetworkDetailsCapture {
     this.captureResponseDelay,
     this.captureResponseError,
     this.onCaptureResponse,
+    this.bodyCaptured,
   });
 
   final bool shouldCaptureResult;
   final Duration? captureResponseDelay;
   final Object? captureResponseError;
   final void Function()? onCaptureResponse;
+  final Completer<void>? bodyCaptured;
 
   @override
   bool shouldCapture(Uri url) => shouldCaptureResult;
@@ -449,7 +488,8 @@ class FakeNetworkDetailsCapture implements NetworkDetailsCapture {
   }
 
   @override
-  Future<(StreamedResponse, Map<String, dynamic>)> captureResponse(
+  Future<(StreamedResponse, Map<String, dynamic>, Future<void>?)>
+      captureResponse(
     StreamedResponse response,
   ) async {
     onCaptureResponse?.call();
@@ -461,7 +501,18 @@ class FakeNetworkDetailsCapture implements NetworkDetailsCapture {
     if (error != null) {
       throw error;
     }
-    return (response, {'headers': Map<String, String>.from(response.headers)});
+    final detail = <String, dynamic>{
+      'headers': Map<String, String>.from(response.headers),
+    };
+    final bodyCaptured = this.bodyCaptured;
+    if (bodyCaptured == null) {
+      return (response, detail, null);
+    }
+    return (
+      response,
+      detail,
+      bodyCaptured.future.then((_) => detail['body'] = 'captured'),
+    );
   }
 }
 
@@ -0,0 +1,141 @@
+import 'package:fake_async/fake_async.dart';
+import 'package:sentry/sentry.dart';
+import 'package:test/test.dart';
+
+import '../test_utils.dart';
+
+void main() {
+  group(MemoryGovernor, () {
+    late Fixture fixture;
+
+    setUp(() {
+      fixture = Fixture();
+    });
+
+    tearDown(() {
+      fixture.sut.close();
+    });
+
+    test('starts without pressure', () {
+      expect(fixture.sut.level, MemoryPressureLevel.normal);
+      expect(fixture.sut.capacityOf(100), 100);
+    });
+
+    test('report raises the level and dispatches the change', () async {
+      fixture.sut.report(MemoryPressureLevel.moderate);
+      fixture.sut.report(MemoryPressureLevel.high);
+      await Future<void>.delayed(Duration.zero);
+
+      expect(fixture.sut.level, MemoryPressureLevel.high);
+      expect(fixture.changes, [
+        (MemoryPressureLevel.normal, MemoryPressureLevel.moderate),
+        (MemoryPressureLevel.moderate, MemoryPressureLevel.high),
+      ]);
+    });
+
+    test('report ignores lower and repeated levels', () async {
+      fixture.sut.report(MemoryPressureLevel.high);
+      fixture.sut.report(MemoryPressureLevel.high);
+      fixture.sut.report(MemoryPressureLevel.moderate);
+      fixture.sut.report(MemoryPressureLevel.normal);
+      await Future<void>.delayed(Duration.zero);
+
+      expect(fixture.sut.level, MemoryPressureLevel.high);
+      expect(fixture.changes, hasLength(1));
+    });
+
+    test('recovers one level per recovery delay', () {
+      fakeAsync((async) {
+        fixture.sut.report(MemoryPressureLevel.critical);
+
+        async.elapse(MemoryGovernor.recoveryDelay);
+        expect(fixture.sut.level, MemoryPressureLevel.high);
+
+        // A report of the current level restarts the delay.
+        async.elapse(MemoryGovernor.recoveryDelay ~/ 2);
+        fixture.sut.report(MemoryPressureLevel.high);
+        async.elapse(MemoryGovernor.recoveryDelay ~/ 2);
+        expect(fixture.sut.level, MemoryPressureLevel.high);
+
+        async.elapse(MemoryGovernor.recoveryDelay ~/ 2);
+        expect(fixture.sut.level, MemoryPressureLevel.moderate);
+
+        async.elapse(MemoryGovernor.recoveryDelay);
+        expect(fixture.sut.level, MemoryPressureLevel.normal);
+        expect(async.pendingTimers, isEmpty);
+
+        async.flushMicrotasks();
+        expect(fixture.changes.map((change) => change.$2), [
+          MemoryPressureLevel.critical,
+          MemoryPressureLevel.high,
+          MemoryPressureLevel.moderate,
+          MemoryPressureLevel.normal,
+        ]);
+      });
+    });
+
+    test('escalate steps up from the minimum', () {
+      fixture.sut.escalate(MemoryPressureLevel.high);
+      expect(fixture.sut.level, MemoryPressureLevel.high);
+
+      fixture.sut.escalate(MemoryPressureLevel.high);
+      expect(fixture.sut.level, MemoryPressureLevel.critical);
+
+      fixture.sut.escalate(MemoryPressureLevel.high);
+      expect(fixture.sut.level, MemoryPressureLevel.critical);
+    });
+
+    test('capacityOf halves per level', () {
+      fixture.sut.report(MemoryPressureLevel.moderate);
+      expect(fixture.sut.capacityOf(100), 50);
+
+      fixture.sut.report(MemoryPressureLevel.high);
+      expect(fixture.sut.capacityOf(100), 25);
+
+      fixture.sut.report(MemoryPressureLevel.critical);
+      expect(fixture.sut.capacityOf(100), 12);
+      expect(fixture.sut.capacityOf(2), 1);
+      expect(fixture.sut.capacityOf(0), 0);
+    });
+
+    test('shouldDropLog drops logs below warn when critical', () {
+      SentryLog log(SentryLogLevel level) => SentryLog(
+            timestamp: DateTime.utc(2026),
+            level: level,
+            body: 'test',
+            attributes: {},
+          );
+
+      fixture.sut.report(MemoryPressureLevel.high);
+      expect(fixture.sut.shouldDropLog(log(SentryLogLevel.trace)), isFalse);
+
+      fixture.sut.report(MemoryPressureLevel.critical);
+      expect(fixture.sut.shouldDropLog(log(SentryLogLevel.info)), isTrue);
+      expect(fixture.sut.shouldDropLog(log(SentryLogLevel.warn)), isFalse);
+      expect(fixture.sut.shouldDropLog(log(SentryLogLevel.fatal)), isFalse);
+    });
+
+    test('close goes back to normal', () {
+      fakeAsync((async) {
+        fixture.sut.report(MemoryPressureLevel.critical);
+        fixture.sut.close();
+
+        expect(fixture.sut.level, MemoryPressureLevel.normal);
+        expect(async.pendingTimers, isEmpty);
+      });
+    });
+  });
+}
+
+class Fixture {
+  final options = defaultTestOptions();
+  final changes = <(MemoryPressureLevel, MemoryPressureLevel)>[];
+
+  MemoryGovernor get sut => options.memoryGovernor;
+
+  Fixture() {
+    options.lifecycleRegistry.registerCallback<OnMemoryPressure>(
+      (event) => changes.add((event.previous, event.level)),
+    );
+  }
+}
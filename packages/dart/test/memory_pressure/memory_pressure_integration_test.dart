@@ -0,0 +1,100 @@
+import 'package:sentry/sentry.dart';
+import 'package:sentry/src/memory_pressure/memory_pressure_integration.dart';
+import 'package:sentry/src/memory_pressure/memory_pressure_source.dart';
+import 'package:test/test.dart';
+
+import '../mocks/mock_telemetry_processor.dart';
+import '../test_utils.dart';
+
+void main() {
+  group(MemoryPressureIntegration, () {
+    late Fixture fixture;
+
+    setUp(() {
+      fixture = Fixture();
+    });
+
+    tearDown(() async {
+      await fixture.sut.close();
+    });
+
+    test('adds integration to SDK', () {
+      fixture.sut.call(fixture.hub, fixture.options);
+
+      expect(
+        fixture.options.sdk.integrations,
+        contains(MemoryPressureIntegration.integrationName),
+      );
+    });
+
+    test('reports the levels of the sources to the governor', () {
+      fixture.sut.call(fixture.hub, fixture.options);
+
+      fixture.source.simulate(MemoryPressureLevel.high);
+
+      expect(fixture.options.memoryGovernor.level, MemoryPressureLevel.high);
+    });
+
+    test('trims the scope breadcrumbs when the level goes up', () async {
+      fixture.sut.call(fixture.hub, fixture.options);
+      for (var i = 0; i < 8; i++) {
+        await fixture.hub.addBreadcrumb(Breadcrumb(message: '$i'));
+      }
+
+      fixture.source.simulate(MemoryPressureLevel.moderate);
+      await Future<void>.delayed(Duration.zero);
+
+      expect(
+        fixture.hub.scope.breadcrumbs.map((b) => b.message),
+        ['4', '5', '6', '7'],
+      );
+    });
+
+    test('flushes the telemetry buffers once the level is high', () async {
+      fixture.sut.call(fixture.hub, fixture.options);
+
+      fixture.source.simulate(MemoryPressureLevel.moderate);
+      await Future<void>.delayed(Duration.zero);
+      expect(fixture.processor.flushCalls, 0);
+
+      fixture.source.simulate(MemoryPressureLevel.high);
+      await Future<void>.delayed(Duration.zero);
+      expect(fixture.processor.flushCalls, 1);
+
+      fixture.source.simulate(MemoryPressureLevel.critical);
+      await Future<void>.delayed(Duration.zero);
+      expect(fixture.processor.flushCalls, 1);
+    });
+
+    test('close stops listening and resets the governor', () async {
+      fixture.sut.call(fixture.hub, fixture.options);
+      fixture.source.simulate(MemoryPressureLevel.moderate);
+
+      await fixture.sut.close();
+      fixture.source.simulate(MemoryPressureLevel.critical);
+
+      expect(fixture.options.memoryGovernor.level, MemoryPressureLevel.normal);
+      expect(
+        fixture.options.lifecycleRegistry.lifecycleCallbacks[OnMemoryPressure],
+        isEmpty,
+      );
+    });
+  });
+}
+
+class Fixture {
+  final options = defaultTestOptions()..maxBreadcrumbs = 8;
+  final source = SimulatedMemoryPressureSource();
+  final processor = MockTelemetryProcessor();
+
+  late final Hub hub;
+  late final MemoryPressureIntegration sut;
+
+  Fixture() {
+    options
+      ..memoryPressureSources.add(source)
+      ..telemetryProcessor = processor;
+    hub = Hub(options);
+    sut = MemoryPressureIntegration();
+  }
+}
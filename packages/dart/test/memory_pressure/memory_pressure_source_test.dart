@@ -0,0 +1,190 @@
+import 'package:fake_async/fake_async.dart';
+import 'package:sentry/sentry.dart';
+import 'package:sentry/src/memory_pressure/memory_pressure_source.dart';
+import 'package:test/test.dart';
+
+void main() {
+  group(SimulatedMemoryPressureSource, () {
+    test('emits the simulated levels', () async {
+      final sut = SimulatedMemoryPressureSource();
+      final levels = <MemoryPressureLevel>[];
+      sut.levels.listen(levels.add);
+
+      sut.simulate(MemoryPressureLevel.high);
+      sut.simulate(MemoryPressureLevel.critical);
+      await sut.close();
+
+      expect(levels, [MemoryPressureLevel.high, MemoryPressureLevel.critical]);
+    });
+  });
+
+  group(CgroupMemoryPressureSource, () {
+    late Fixture fixture;
+
+    setUp(() {
+      fixture = Fixture();
+    });
+
+    test('levelOfPressure maps avg10 to levels', () {
+      String pressure(double some, double full) =>
+          'some avg10=$some avg60=0.00 avg300=0.00 total=1\n'
+          'full avg10=$full avg60=0.00 avg300=0.00 total=1\n';
+
+      expect(
+        CgroupMemoryPressureSource.levelOfPressure(pressure(9.99, 0)),
+        MemoryPressureLevel.normal,
+      );
+      expect(
+        CgroupMemoryPressureSource.levelOfPressure(pressure(10, 0)),
+        MemoryPressureLevel.moderate,
+      );
+      expect(
+        CgroupMemoryPressureSource.levelOfPressure(pressure(30, 9)),
+        MemoryPressureLevel.high,
+      );
+      expect(
+        CgroupMemoryPressureSource.levelOfPressure(pressure(30, 10)),
+        MemoryPressureLevel.critical,
+      );
+      expect(
+        CgroupMemoryPressureSource.levelOfPressure('garbage'),
+        MemoryPressureLevel.normal,
+      );
+    });
+
+    test('levelOfEvents maps increased counters to levels', () {
+      final previous = CgroupMemoryPressureSource.parseEvents(
+        'low 0\nhigh 1\nmax 2\noom 0\noom_kill 0\n',
+      );
+      MemoryPressureLevel levelOf(String events) =>
+          CgroupMemoryPressureSource.levelOfEvents(
+            previous,
+            CgroupMemoryPressureSource.parseEvents(events),
+          );
+
+      expect(
+        previous,
+        {'low': 0, 'high': 1, 'max': 2, 'oom': 0, 'oom_kill': 0},
+      );
+      expect(
+        levelOf('low 5\nhigh 1\nmax 2\noom 0\noom_kill 0\n'),
+        MemoryPressureLevel.normal,
+      );
+      expect(
+        levelOf('low 0\nhigh 2\nmax 2\noom 0\noom_kill 0\n'),
+        MemoryPressureLevel.moderate,
+      );
+      expect(
+        levelOf('low 0\nhigh 2\nmax 3\noom 0\noom_kill 0\n'),
+        MemoryPressureLevel.high,
+      );
+      expect(
+        levelOf('low 0\nhigh 1\nmax 2\noom 0\noom_kill 1\n'),
+        MemoryPressureLevel.critical,
+      );
+    });
+
+    test('poll reads the files of the cgroup of the process', () async {
+      final sut = fixture.getSut();
+      fixture.events = 'high 0\nmax 0\noom 0\noom_kill 0\n';
+
+      expect(await sut.poll(), MemoryPressureLevel.normal);
+      expect(fixture.reads, [
+        '/proc/self/cgroup',
+        '${fixture.directory}/memory.pressure',
+        '${fixture.directory}/memory.events',
+      ]);
+    });
+
+    test('poll uses the root cgroup in a container', () async {
+      fixture.cgroup = '0::/\n';
+      final sut = fixture.getSut();
+
+      await sut.poll();
+
+      expect(fixture.reads, contains('/sys/fs/cgroup/memory.events'));
+    });
+
+    test('poll takes the higher level of pressure and events', () async {
+      final sut = fixture.getSut();
+      fixture.pressure = 'some avg10=12.00 avg60=0.00 avg300=0.00 total=1\n';
+      fixture.events = 'high 0\nmax 0\noom 0\noom_kill 0\n';
+
+      // The first counters are the baseline.
+      expect(await sut.poll(), MemoryPressureLevel.moderate);
+
+      fixture.events = 'high 0\nmax 1\noom 0\noom_kill 0\n';
+      expect(await sut.poll(), MemoryPressureLevel.high);
+
+      expect(await sut.poll(), MemoryPressureLevel.moderate);
+    });
+
+    test('poll returns null without a cgroup v2 memory controller', () async {
+      fixture.cgroup = '12:memory:/user.slice\n';
+      expect(await fixture.getSut().poll(), isNull);
+
+      fixture = Fixture();
+      expect(await fixture.getSut().poll(), isNull);
+    });
+
+    test('emits elevated levels while listened to', () {
+      fakeAsync((async) {
+        final sut = fixture.getSut();
+        final levels = <MemoryPressureLevel>[];
+        final subscription = sut.levels.listen(levels.add);
+        fixture.events = 'high 0\nmax 0\noom 0\noom_kill 0\n';
+        async.flushMicrotasks();
+        expect(levels, isEmpty);
+
+        fixture.events = 'high 0\nmax 0\noom 1\noom_kill 0\n';
+        async.elapse(sut.pollInterval);
+        expect(levels, [MemoryPressureLevel.critical]);
+
+        async.elapse(sut.pollInterval);
+        expect(levels, [MemoryPressureLevel.critical]);
+
+        subscription.cancel();
+        expect(async.pendingTimers, isEmpty);
+      });
+    });
+
+    test('stops polling if the files can not be read', () {
+      fakeAsync((async) {
+        final sut = fixture.getSut();
+        sut.levels.listen((_) {});
+        fixture.events = 'high 0\nmax 0\noom 0\noom_kill 0\n';
+        async.flushMicrotasks();
+        expect(async.pendingTimers, hasLength(1));
+
+        fixture.events = null;
+        async.elapse(sut.pollInterval);
+
+        expect(async.pendingTimers, isEmpty);
+      });
+    });
+  });
+}
+
+class Fixture {
+  final directory = '/sys/fs/cgroup/user.slice/app.scope';
+  String? cgroup = '0::/user.slice/app.scope\n';
+  String? pressure;
+  String? events;
+  final reads = <String>[];
+
+  CgroupMemoryPressureSource getSut() {
+    return CgroupMemoryPressureSource((path) async {
+      reads.add(path);
+      if (path == '/proc/self/cgroup') {
+        return cgroup;
+      }
+      if (path.endsWith('/memory.pressure')) {
+        return pressure;
+      }
+      if (path.endsWith('/memory.events')) {
+        return events;
+      }
+      return null;
+    });
+  }
+}
@@ -14,4 +14,11 @@ class FakeSpanCapturePipeline extends SpanCapturePipeline {
     capturedSpan = span;
     capturedScope = scope;
   }
+
+  bool closed = false;
+
+  @override
+  void close() {
+    closed = true;
+  }
 }
@@ -191,6 +191,56 @@ void main() {
     expect(result, isNull);
   });
 
+  test('does not read the clock when nothing is rate limited', () {
+    final rateLimiter = fixture.getSut();
+    final envelope = SentryEnvelope(
+      SentryEnvelopeHeader.newEventId(),
+      [SentryEnvelopeItem.fromEvent(SentryEvent())],
+    );
+
+    final result = rateLimiter.filter(envelope);
+
+    expect(result, same(envelope));
+    expect(fixture.clockCalls, 0);
+  });
+
+  test('stops reading the clock once all limits have expired', () {
+    final rateLimiter = fixture.getSut();
+    fixture.dateTimeToReturn = 0;
+    final envelope = SentryEnvelope(
+      SentryEnvelopeHeader.newEventId(),
+      [SentryEnvelopeItem.fromEvent(SentryEvent())],
+    );
+
+    rateLimiter.updateRetryAfterLimits('1:error:key, 2:session:key', null, 1);
+    expect(rateLimiter.filter(envelope), isNull);
+
+    fixture.dateTimeToReturn = 2001;
+    expect(rateLimiter.filter(envelope), same(envelope));
+
+    final clockCalls = fixture.clockCalls;
+    expect(rateLimiter.filter(envelope), same(envelope));
+    expect(fixture.clockCalls, clockCalls);
+  });
+
+  test('keeps the order of the items that are not rate limited', () {
+    final rateLimiter = fixture.getSut();
+    fixture.dateTimeToReturn = 0;
+    final first = SentryEnvelopeItem.fromEvent(SentryEvent());
+    final transaction =
+        SentryEnvelopeItem.fromTransaction(fixture.getTransaction());
+    final last = SentryEnvelopeItem.fromEvent(SentryEvent());
+    final envelope = SentryEnvelope(
+      SentryEnvelopeHeader.newEventId(),
+      [first, transaction, last],
+    );
+
+    rateLimiter.updateRetryAfterLimits('60:transaction:key', null, 1);
+
+    final result = rateLimiter.filter(envelope);
+    expect(result!.items, [first, last]);
+  });
+
   test('dropping of event recorded', () {
     final rateLimiter = fixture.getSut();
 
@@ -516,6 +566,7 @@ void main() {
 
 class Fixture {
   var dateTimeToReturn = 0;
+  var clockCalls = 0;
 
   late var mockRecorder = MockClientReportRecorder();
 
@@ -528,6 +579,7 @@ class Fixture {
   }
 
   DateTime _currentDateTime() {
+    clockCalls++;
     return DateTime.fromMillisecondsSinceEpoch(dateTimeToReturn);
   }
 
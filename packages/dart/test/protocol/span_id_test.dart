@@ -20,4 +20,23 @@ void main() {
 
     expect(id1, id2);
   });
+
+  test('newId is 16 lowercase hex characters', () {
+    final id = SpanId.newId().toString();
+    expect(id, matches(RegExp(r'^[0-9a-f]{16}$')));
+  });
+
+  test('newId roundtrip', () {
+    final id = SpanId.newId();
+    expect(SpanId.fromId(id.toString()), id);
+    expect(SpanId.fromId(id.toString()).hashCode, id.hashCode);
+  });
+
+  test('newId generates unique ids across pool refills', () {
+    final ids = <SpanId>{};
+    for (var i = 0; i < 2000; i++) {
+      ids.add(SpanId.newId());
+    }
+    expect(ids.length, 2000);
+  });
 }
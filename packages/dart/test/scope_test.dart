@@ -225,6 +225,29 @@ void main() {
     expect(sut.breadcrumbs.length, maxBreadcrumbs);
   });
 
+  test('keeps fewer $Breadcrumb under memory pressure', () {
+    final sut = fixture.getSut(maxBreadcrumbs: 8);
+    Breadcrumb breadcrumb(int i) =>
+        Breadcrumb(message: '$i', timestamp: DateTime.utc(2019));
+
+    for (var i = 0; i < 8; i++) {
+      sut.addBreadcrumb(breadcrumb(i));
+    }
+    fixture.options.memoryGovernor.report(MemoryPressureLevel.high);
+    sut.trimBreadcrumbs();
+
+    expect(sut.breadcrumbs.map((b) => b.message), ['6', '7']);
+
+    sut.addBreadcrumb(breadcrumb(8));
+
+    expect(sut.breadcrumbs.map((b) => b.message), ['7', '8']);
+
+    fixture.options.memoryGovernor.close();
+    sut.addBreadcrumb(breadcrumb(9));
+
+    expect(sut.breadcrumbs.map((b) => b.message), ['7', '8', '9']);
+  });
+
   test('clears $Breadcrumb list', () {
     final sut = fixture.getSut();
 
@@ -1577,6 +1577,30 @@ void main() {
       expect(event.fingerprint!.contains('process'), true);
     });
 
+    test('should hand the event to the transport synchronously', () async {
+      final client = fixture.getSut();
+      final captured = client.captureEvent(fakeEvent);
+
+      // No microtask ran yet, all processing steps are synchronous.
+      expect(fixture.transport.called(1), isTrue);
+      await captured;
+    });
+
+    test('should continue processing after an async eventProcessor',
+        () async {
+      final client = fixture.getSut(beforeSend: (event, hint) async {
+        return event..tags = {...?event.tags, 'async': 'true'};
+      });
+      final captured = client.captureEvent(fakeEvent);
+
+      expect(fixture.transport.called(0), isTrue);
+      await captured;
+
+      final event = await eventFromEnvelope(fixture.transport.envelopes.first);
+      expect(event.tags?['async'], 'true');
+      expect(event.tags?['theme'], 'material');
+    });
+
     test('should execute eventProcessors for feedback', () async {
       final client = fixture.getSut();
       final fakeFeedback = fixture.fakeFeedback();
@@ -1821,6 +1845,15 @@ void main() {
         expect(pipeline.capturedSpan, same(span));
         expect(pipeline.capturedScope, same(scope));
       });
+
+      test('closes span capture pipeline on close', () async {
+        final pipeline = FakeSpanCapturePipeline();
+        final client = fixture.getSut(spanCapturePipeline: pipeline);
+
+        await client.close();
+
+        expect(pipeline.closed, isTrue);
+      });
     });
   });
 
@@ -446,6 +446,84 @@ void main() {
       expect(envelopeData, expected);
     });
 
+    test('stops the serialization timer of skipped and throwing items',
+        () async {
+      final itemHeader = SentryEnvelopeItemHeader(SentryItemType.event,
+          contentType: 'application/json');
+      final item = SentryEnvelopeItem(
+          itemHeader, () async => utf8.encode('{fixture}'));
+      final throwingItem = SentryEnvelopeItem(
+          itemHeader, () async => throw Exception('fixture-exception'));
+      final tooLarge = SentryEnvelopeItem.fromAttachment(
+        SentryAttachment.fromLoader(
+          loader: () => Uint8List.fromList(List.filled(10, 0)),
+          filename: 'large.txt',
+        ),
+      );
+      final sut = SentryEnvelope(
+        SentryEnvelopeHeader(SentryId.newId(), null),
+        [item, throwingItem, tooLarge],
+      );
+      final options = defaultTestOptions()
+        ..automatedTestMode = false
+        ..maxAttachmentSize = 5
+        ..enableSdkOverheadStats = true;
+
+      await sut.envelopeStream(options).drain<void>();
+      expect(options.sdkOverheadStats.snapshot().single.count, 3);
+
+      options.sdkOverheadStats.reset();
+      options.automatedTestMode = true;
+      await expectLater(
+          sut.envelopeStream(options).drain<void>(), throwsException);
+      expect(options.sdkOverheadStats.snapshot().single.count, 2);
+    });
+
+    test('snapshot encodes the same bytes as envelopeStream', () async {
+      final attachment = SentryAttachment.fromLoader(
+        loader: () => Uint8List.fromList([1, 2, 3, 4]),
+        filename: 'test.txt',
+      );
+      final tooLarge = SentryAttachment.fromLoader(
+        loader: () => Uint8List.fromList(List.filled(10, 0)),
+        filename: 'large.txt',
+      );
+      final sut = SentryEnvelope.fromEvent(
+        SentryEvent(message: SentryMessage('fixture-message')),
+        SdkVersion(name: 'fixture-name', version: 'fixture-version'),
+        dsn: fakeDsn,
+        attachments: [attachment, tooLarge],
+      );
+      final options = defaultTestOptions()..maxAttachmentSize = 5;
+
+      final envelopeData = <int>[];
+      await sut.envelopeStream(options).forEach(envelopeData.addAll);
+
+      final snapshot = await sut.snapshot(options);
+      expect(snapshot.encode(), envelopeData);
+    });
+
+    test('snapshot ignores throwing envelope items', () async {
+      final itemHeader = SentryEnvelopeItemHeader(SentryItemType.event,
+          contentType: 'application/json');
+      final item = SentryEnvelopeItem(
+          itemHeader, () async => utf8.encode('{fixture}'));
+      final throwingItem = SentryEnvelopeItem(
+          itemHeader, () async => throw Exception('fixture-exception'));
+      final sut = SentryEnvelope(
+        SentryEnvelopeHeader(SentryId.newId(), null),
+        [item, throwingItem],
+      );
+      final options = defaultTestOptions()..automatedTestMode = false;
+
+      final envelopeData = <int>[];
+      await sut.envelopeStream(options).forEach(envelopeData.addAll);
+
+      final snapshot = await sut.snapshot(options);
+      expect(snapshot.items.length, 1);
+      expect(snapshot.encode(), envelopeData);
+    });
+
     // This test passes if no exceptions are thrown, thus no asserts.
     // This is a test for https://github.com/getsentry/sentry-dart/issues/523
     test('serialize with non-serializable class', () async {
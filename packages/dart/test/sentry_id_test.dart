@@ -32,4 +32,27 @@ void main() {
   test('newId should not be equal to newId', () {
     expect(SentryId.newId() == SentryId.newId(), false);
   });
+
+  test('newId is 32 lowercase hex characters', () {
+    final id = SentryId.newId().toString();
+    expect(id, matches(RegExp(r'^[0-9a-f]{32}$')));
+  });
+
+  test('newId is not empty', () {
+    for (var i = 0; i < 1000; i++) {
+      expect(SentryId.newId(), isNot(SentryId.empty()));
+    }
+  });
+
+  test('non-hex id is kept verbatim', () {
+    final id = SentryId.fromId('ABCDEF');
+    expect(id.toString(), 'ABCDEF');
+    expect(id, SentryId.fromId('ABCDEF'));
+    expect(id.hashCode, SentryId.fromId('ABCDEF').hashCode);
+  });
+
+  test('parsed id has same hashCode', () {
+    final id = SentryId.newId();
+    expect(id.hashCode, SentryId.fromId(id.toString()).hashCode);
+  });
 }
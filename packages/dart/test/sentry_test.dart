@@ -7,6 +7,7 @@ import 'package:sentry/sentry.dart';
 import 'package:sentry/src/dart_exception_type_identifier.dart';
 import 'package:sentry/src/event_processor/deduplication_event_processor.dart';
 import 'package:sentry/src/feature_flags_integration.dart';
+import 'package:sentry/src/memory_pressure/memory_pressure_integration.dart';
 import 'package:sentry/src/sentry_tracer.dart';
 import 'package:sentry/src/telemetry/metric/metrics_setup_integration.dart';
 import 'package:sentry/src/telemetry/processing/processor_integration.dart';
@@ -342,6 +343,27 @@ void main() {
       );
     });
 
+    test('should add $MemoryPressureIntegration', () async {
+      late SentryOptions optionsReference;
+      final options = defaultTestOptions();
+
+      await Sentry.init(
+        options: options,
+        (options) {
+          options.dsn = fakeDsn;
+          optionsReference = options;
+        },
+        appRunner: appRunner,
+      );
+
+      expect(
+        optionsReference.integrations
+            .whereType<MemoryPressureIntegration>()
+            .length,
+        1,
+      );
+    });
+
     test('should add only web compatible default integrations', () async {
       final options = defaultTestOptions();
       await Sentry.init(
@@ -288,6 +288,66 @@ void main() {
       expect(currentTimer, newTimer);
     });
 
+    test('starting a child keeps the auto finish timer', () async {
+      final sut = fixture.getSut(autoFinishAfter: Duration(milliseconds: 200));
+
+      final currentTimer = sut.autoFinishAfterTimer!;
+
+      sut.startChild('operation');
+
+      expect(sut.autoFinishAfterTimer, same(currentTimer));
+    });
+
+    test('starting a child postpones auto finish', () async {
+      final sut = fixture.getSut(autoFinishAfter: Duration(milliseconds: 100));
+
+      await Future.delayed(Duration(milliseconds: 60));
+      final child = sut.startChild('operation');
+      await child.finish();
+
+      await Future.delayed(Duration(milliseconds: 60));
+      expect(sut.finished, false);
+
+      await Future.delayed(Duration(milliseconds: 80));
+      expect(sut.finished, true);
+    });
+
+    test('starting a child postpones auto finish with a fixed clock',
+        () async {
+      final now = getUtcDateTime();
+      fixture.hub.options.clock = () => now;
+      final sut = fixture.getSut(autoFinishAfter: Duration(milliseconds: 100));
+
+      await Future.delayed(Duration(milliseconds: 60));
+      final child = sut.startChild('operation');
+      await child.finish();
+
+      await Future.delayed(Duration(milliseconds: 60));
+      expect(sut.finished, false);
+
+      await Future.delayed(Duration(milliseconds: 80));
+      expect(sut.finished, true);
+    });
+
+    test('end trimmed to spans added to children', () async {
+      final sut = fixture.getSut(trimEnd: true);
+      final endTimestamp = getUtcDateTime().add(Duration(minutes: 1));
+
+      final child = sut.startChild('operation-a');
+      await child.finish(endTimestamp: endTimestamp);
+      final added = SentrySpan(
+        sut,
+        SentrySpanContext(operation: 'operation-b'),
+        fixture.hub,
+      );
+      await added.finish(endTimestamp: endTimestamp.add(Duration(seconds: 1)));
+      sut.children.add(added);
+
+      await sut.finish(endTimestamp: endTimestamp.add(Duration(seconds: 2)));
+
+      expect(sut.endTimestamp, added.endTimestamp);
+    });
+
     test('tracer finish needs child to finish', () async {
       final sut = fixture.getSut(waitForChildren: true);
 
@@ -0,0 +1,97 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:sentry/sentry.dart';
+import 'package:sentry/src/telemetry/attribute_store.dart';
+import 'package:test/test.dart';
+
+void main() {
+  group('$SentryAttributeStore', () {
+    test('sets, replaces and removes attributes', () {
+      final store = SentryAttributeStore();
+      store['a'] = SentryAttribute.string('1');
+      store['b'] = SentryAttribute.int(2);
+      store['a'] = SentryAttribute.string('3');
+
+      expect(store.length, 2);
+      expect(store['a']?.value, '3');
+
+      store.remove('a');
+
+      expect(store.length, 1);
+      expect(store['a'], isNull);
+      expect(store['b']?.value, 2);
+    });
+
+    test('setIfAbsent does not replace existing attributes', () {
+      final store = SentryAttributeStore();
+      store['a'] = SentryAttribute.string('existing');
+      store.setIfAbsent('a', SentryAttribute.string('new'));
+      store.setIfAbsent('b', SentryAttribute.string('new'));
+
+      expect(store['a']?.value, 'existing');
+      expect(store['b']?.value, 'new');
+    });
+
+    test('keeps insertion order beyond inline capacity', () {
+      final store = SentryAttributeStore();
+      const count = SentryAttributeStore.inlineCapacity + 4;
+      for (var i = 0; i < count; i++) {
+        store['key$i'] = SentryAttribute.int(i);
+      }
+      store['key0'] = SentryAttribute.int(100);
+
+      expect(store.length, count);
+      expect(
+        store.asUnmodifiableMap().keys,
+        [for (var i = 0; i < count; i++) 'key$i'],
+      );
+      expect(store['key0']?.value, 100);
+    });
+
+    test('view reflects changes and cannot be mutated', () {
+      final store = SentryAttributeStore();
+      final view = store.asUnmodifiableMap();
+      store['a'] = SentryAttribute.bool(true);
+
+      expect(view['a']?.value, true);
+      expect(
+        () => view['b'] = SentryAttribute.bool(false),
+        throwsUnsupportedError,
+      );
+    });
+
+    test('writeJson matches toJson', () {
+      final store = SentryAttributeStore();
+      store['string'] = SentryAttribute.string('value "quoted"');
+      store['int'] = SentryAttribute.int(42);
+      store['bool'] = SentryAttribute.bool(true);
+      store['double'] = SentryAttribute.double(3.14);
+      store['array'] = SentryAttribute.stringArray(['a', 'b']);
+
+      // Encode twice to also cover the cached encodings.
+      for (var i = 0; i < 2; i++) {
+        final out = BytesBuilder();
+        store.writeJson(out);
+        expect(jsonDecode(utf8.decode(out.takeBytes())), store.toJson());
+      }
+    });
+
+    test('encodeWithAttributes appends attributes member', () {
+      final bytes = SentryAttributeStore.encodeWithAttributes(
+        {'name': 'span'},
+        (out) => SentryAttributeStore.writeJsonMap(
+          {'key': SentryAttribute.string('value')},
+          out,
+        ),
+      );
+
+      expect(jsonDecode(utf8.decode(bytes)), {
+        'name': 'span',
+        'attributes': {
+          'key': {'value': 'value', 'type': 'string'},
+        },
+      });
+    });
+  });
+}
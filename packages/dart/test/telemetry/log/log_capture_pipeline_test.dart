@@ -221,6 +221,36 @@ void main() {
       });
     });
 
+    group('under critical memory pressure', () {
+      setUp(() {
+        fixture.options.memoryGovernor.report(MemoryPressureLevel.critical);
+      });
+
+      tearDown(() {
+        fixture.options.memoryGovernor.close();
+      });
+
+      test('drops logs below warn and records them as backpressure',
+          () async {
+        await fixture.pipeline.captureLog(givenLog(), scope: fixture.scope);
+
+        expect(fixture.processor.addedLogs, isEmpty);
+        final lostLog = fixture.recorder.lostLogs.single;
+        expect(lostLog.reason, DiscardReason.backpressure);
+        expect(lostLog.count, 1);
+        expect(lostLog.bytes, isNull);
+      });
+
+      test('keeps warnings', () async {
+        final log = givenLog()..level = SentryLogLevel.warn;
+
+        await fixture.pipeline.captureLog(log, scope: fixture.scope);
+
+        expect(fixture.processor.addedLogs.single, same(log));
+        expect(fixture.recorder.lostLogs, isEmpty);
+      });
+    });
+
     group('when capturing fails unexpectedly', () {
       test('records lost log as internal SDK error', () async {
         fixture.options.automatedTestMode = false;
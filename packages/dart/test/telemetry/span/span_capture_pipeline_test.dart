@@ -1,7 +1,10 @@
 import 'package:sentry/sentry.dart';
+import 'package:sentry/src/client_reports/discard_reason.dart';
+import 'package:sentry/src/transport/data_category.dart';
 import 'package:sentry/src/telemetry/span/span_capture_pipeline.dart';
 import 'package:test/test.dart';
 
+import '../../mocks/mock_client_report_recorder.dart';
 import '../../mocks/mock_telemetry_processor.dart';
 import '../../test_utils.dart';
 
@@ -306,6 +309,165 @@ void main() {
         expect(fixture.processor.addedSpans.first, same(span));
       });
     });
+
+    group('when tail sampling is enabled', () {
+      late MockClientReportRecorder recorder;
+
+      setUp(() {
+        recorder = MockClientReportRecorder();
+        fixture.options.recorder = recorder;
+      });
+
+      test('holds child spans until the segment span finishes', () async {
+        fixture.options.tailSamplingRules = [TailSamplingRule.error()];
+        final root = fixture.createRecordingSpan(name: 'root');
+        final child = fixture.createChildSpan(root);
+        child.status = SentrySpanStatusV2.error;
+
+        await fixture.pipeline.captureSpan(child, scope: fixture.scope);
+        final other = fixture.createChildSpan(root);
+        await fixture.pipeline.captureSpan(other, scope: fixture.scope);
+        await fixture.pipeline.captureSpan(root, scope: fixture.scope);
+
+        expect(fixture.processor.addedSpans, [child, other, root]);
+      });
+
+      test('discards segments without a matching span', () async {
+        fixture.options.tailSamplingRules = [TailSamplingRule.error()];
+        final root = fixture.createRecordingSpan(name: 'root');
+        final child = fixture.createChildSpan(root);
+
+        await fixture.pipeline.captureSpan(child, scope: fixture.scope);
+        await fixture.pipeline.captureSpan(root, scope: fixture.scope);
+
+        expect(fixture.processor.addedSpans, isEmpty);
+        expect(
+          recorder.discardedEvents.single.reason,
+          DiscardReason.sampleRate,
+        );
+        expect(recorder.discardedEvents.single.category, DataCategory.span);
+        expect(recorder.discardedEvents.single.quantity, 2);
+      });
+
+      test('keeps segments with a slow span', () async {
+        fixture.options.tailSamplingRules = [
+          TailSamplingRule.durationAtLeast(Duration(seconds: 1)),
+        ];
+        final root = fixture.createRecordingSpan(name: 'root');
+        final child = fixture.createChildSpan(root);
+        child.end(
+          endTimestamp: child.startTimestamp.add(Duration(seconds: 2)),
+        );
+
+        await fixture.pipeline.captureSpan(child, scope: fixture.scope);
+        await fixture.pipeline.captureSpan(root, scope: fixture.scope);
+
+        expect(fixture.processor.addedSpans, [child, root]);
+      });
+
+      test('keeps segments with a matching op', () async {
+        fixture.options.tailSamplingRules = [TailSamplingRule.op('db')];
+        final root = fixture.createRecordingSpan(name: 'root');
+        root.setAttribute(
+          SemanticAttributesConstants.sentryOp,
+          SentryAttribute.string('db'),
+        );
+
+        await fixture.pipeline.captureSpan(root, scope: fixture.scope);
+
+        expect(fixture.processor.addedSpans, [root]);
+      });
+
+      test('drops spans beyond the per segment limit', () async {
+        fixture.options.tailSamplingRules = [TailSamplingRule.error()];
+        fixture.options.tailSamplingMaxSpansPerSegment = 1;
+        final root = fixture.createRecordingSpan(name: 'root');
+
+        await fixture.pipeline
+            .captureSpan(fixture.createChildSpan(root), scope: fixture.scope);
+        await fixture.pipeline
+            .captureSpan(fixture.createChildSpan(root), scope: fixture.scope);
+
+        expect(recorder.discardedEvents.single.quantity, 1);
+      });
+
+      test('decides the oldest segment when too many are pending', () async {
+        fixture.options.tailSamplingRules = [TailSamplingRule.error()];
+        fixture.options.tailSamplingMaxSegments = 1;
+        final first = fixture.createRecordingSpan(name: 'first');
+        final second = fixture.createRecordingSpan(name: 'second');
+
+        await fixture.pipeline
+            .captureSpan(fixture.createChildSpan(first), scope: fixture.scope);
+        await fixture.pipeline
+            .captureSpan(fixture.createChildSpan(second), scope: fixture.scope);
+
+        expect(recorder.discardedEvents.single.quantity, 1);
+
+        // Late spans of an evicted segment follow its decision.
+        first.status = SentrySpanStatusV2.error;
+        await fixture.pipeline.captureSpan(first, scope: fixture.scope);
+
+        expect(fixture.processor.addedSpans, isEmpty);
+        expect(recorder.discardedEvents.length, 2);
+      });
+
+      test('late spans follow the decision of their segment', () async {
+        fixture.options.tailSamplingRules = [TailSamplingRule.error()];
+        fixture.options.tailSamplingMaxSegments = 1;
+        final first = fixture.createRecordingSpan(name: 'first');
+        first.status = SentrySpanStatusV2.error;
+        await fixture.pipeline.captureSpan(first, scope: fixture.scope);
+
+        for (var i = 0; i < 3; i++) {
+          final other = fixture.createRecordingSpan(name: 'other');
+          await fixture.pipeline
+              .captureSpan(fixture.createChildSpan(other), scope: fixture.scope);
+          await fixture.pipeline.captureSpan(other, scope: fixture.scope);
+        }
+        final child = fixture.createChildSpan(first);
+        await fixture.pipeline.captureSpan(child, scope: fixture.scope);
+
+        expect(fixture.processor.addedSpans, [first, child]);
+        expect(fixture.pipeline.pendingTailSamplingSegmentCount, 0);
+      });
+
+      test('decides segments that are pending for too long', () async {
+        fixture.options.tailSamplingRules = [TailSamplingRule.error()];
+        fixture.options.tailSamplingMaxSegmentAge =
+            Duration(milliseconds: 10);
+        final first = fixture.createRecordingSpan(name: 'first');
+        final second = fixture.createRecordingSpan(name: 'second');
+
+        await fixture.pipeline
+            .captureSpan(fixture.createChildSpan(first), scope: fixture.scope);
+        await Future.delayed(Duration(milliseconds: 20));
+        await fixture.pipeline
+            .captureSpan(fixture.createChildSpan(second), scope: fixture.scope);
+
+        expect(recorder.discardedEvents.single.quantity, 1);
+        expect(fixture.pipeline.pendingTailSamplingSegmentCount, 1);
+      });
+
+      test('decides pending segments on close', () async {
+        fixture.options.tailSamplingRules = [TailSamplingRule.error()];
+        final root = fixture.createRecordingSpan(name: 'root');
+        final matching = fixture.createRecordingSpan(name: 'matching');
+        final error = fixture.createChildSpan(matching);
+        error.status = SentrySpanStatusV2.error;
+
+        await fixture.pipeline
+            .captureSpan(fixture.createChildSpan(root), scope: fixture.scope);
+        await fixture.pipeline
+            .captureSpan(fixture.createChildSpan(root), scope: fixture.scope);
+        await fixture.pipeline.captureSpan(error, scope: fixture.scope);
+        fixture.pipeline.close();
+
+        expect(fixture.processor.addedSpans, [error]);
+        expect(recorder.discardedEvents.single.quantity, 2);
+        expect(fixture.pipeline.pendingTailSamplingSegmentCount, 0);
+      });
+    });
   });
 }
 
@@ -335,4 +497,14 @@ class Fixture {
       samplingDecision: SentryTracesSamplingDecision(true),
     );
   }
+
+  RecordingSentrySpanV2 createChildSpan(RecordingSentrySpanV2 parent) {
+    return RecordingSentrySpanV2.child(
+      parent: parent,
+      name: 'child-span',
+      onSpanEnd: (_) async {},
+      clock: options.clock,
+      dscCreator: (s) => SentryTraceContextHeader(SentryId.newId(), 'key'),
+    );
+  }
 }
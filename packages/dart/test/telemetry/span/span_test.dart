@@ -1,3 +1,5 @@
+import 'dart:convert';
+
 import 'package:sentry/sentry.dart';
 import 'package:test/test.dart';
 
@@ -417,6 +419,17 @@ void main() {
         expect(attributes['double_attr'], {'value': 3.14, 'type': 'double'});
       });
 
+      test('toJsonBytes encodes the same content as toJson', () {
+        final span = fixture.createSpan(name: 'test-span');
+        span.setAttribute('string_attr', SentryAttribute.string('value'));
+        span.setAttribute('int_attr', SentryAttribute.int(42));
+        span.end();
+
+        final decoded = jsonDecode(utf8.decode(span.toJsonBytes()));
+
+        expect(decoded, equals(jsonDecode(jsonEncode(span.toJson()))));
+      });
+
       test('end_timestamp is null when span is not finished', () {
         final span = fixture.createSpan(name: 'test-span');
 
@@ -0,0 +1,418 @@
+import 'package:sentry/sentry.dart';
+import 'package:sentry/src/sentry_tracer.dart';
+import 'package:test/test.dart';
+
+import '../../mocks/mock_sentry_client.dart';
+import '../../test_utils.dart';
+
+void main() {
+  group('$OperationAggregator', () {
+    late Fixture fixture;
+
+    setUp(() {
+      fixture = Fixture();
+    });
+
+    test('is disabled without operationAggregation', () {
+      fixture.options.operationAggregation = null;
+
+      expect(fixture.getSut(), isNull);
+    });
+
+    test('returns one aggregator per operation, system and origin', () {
+      final sut = fixture.getSut();
+
+      expect(fixture.getSut(), same(sut));
+      expect(fixture.getSut(system: 'other'), isNot(same(sut)));
+      expect(fixture.getSut(operation: 'db.sql.query'), isNot(same(sut)));
+    });
+
+    test('summarizes operations into one span', () {
+      final sut = fixture.getSut()!;
+      final parent = fixture.parentSpan();
+
+      for (var i = 0; i < 3; i++) {
+        final report = sut.record(
+          parent,
+          group: 'box',
+          name: 'put',
+          start: fixture.at(i * 1000),
+          end: fixture.at(i * 1000 + 100),
+          bytes: 10,
+        );
+        expect(report, isFalse);
+      }
+      sut.record(
+        parent,
+        group: 'box',
+        name: 'get',
+        start: fixture.at(5000),
+        end: fixture.at(5010),
+      );
+      sut.flush();
+
+      final span = fixture.tracer.children.single;
+      expect(span.context.operation, 'db');
+      expect(span.origin, 'auto.db.test');
+      expect(span.status, SpanStatus.ok());
+      expect(span.startTimestamp, fixture.at(0));
+      expect(span.endTimestamp, fixture.at(5010));
+      expect(span.data['db.system'], 'test');
+      expect(span.data['db.aggregate.box.put.count'], 3);
+      expect(span.data['db.aggregate.box.put.total_ms'], 0.3);
+      expect(span.data['db.aggregate.box.put.max_ms'], 0.1);
+      expect(span.data['db.aggregate.box.put.bytes'], 30);
+      expect(
+        span.data['db.aggregate.box.put.histogram'],
+        [0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+      );
+      expect(span.data['db.aggregate.box.get.count'], 1);
+      expect(span.data.containsKey('db.aggregate.box.get.bytes'), isFalse);
+    });
+
+    test('reports outliers and failures', () {
+      fixture.options.operationAggregation = SentryOperationAggregation(
+        outlierThreshold: Duration(milliseconds: 5),
+      );
+      final sut = fixture.getSut()!;
+      final parent = fixture.parentSpan();
+
+      final outlier = sut.record(
+        parent,
+        group: 'box',
+        name: 'put',
+        start: fixture.at(0),
+        end: fixture.at(5000),
+      );
+      final failure = sut.record(
+        parent,
+        group: 'box',
+        name: 'put',
+        start: fixture.at(0),
+        end: fixture.at(1),
+        failed: true,
+      );
+      sut.flush();
+
+      expect(outlier, isTrue);
+      expect(failure, isTrue);
+      final span = fixture.tracer.children.single;
+      expect(span.status, SpanStatus.internalError());
+      expect(span.data['db.aggregate.box.put.count'], 2);
+      expect(span.data['db.aggregate.box.put.errors'], 1);
+      expect(span.data['db.aggregate.box.put.histogram'].last, 0);
+    });
+
+    test('does not record without a parent span', () {
+      final sut = fixture.getSut()!;
+
+      final report = sut.record(
+        null,
+        group: 'box',
+        name: 'put',
+        start: fixture.at(0),
+        end: fixture.at(1),
+      );
+      sut.flush();
+
+      expect(report, isFalse);
+      expect(fixture.tracer.children, isEmpty);
+    });
+
+    test('summarizes interleaved parent spans separately', () {
+      final sut = fixture.getSut()!;
+      final otherTracer = SentryTracer(
+        SentryTransactionContext('other', 'operation'),
+        fixture.hub,
+      );
+
+      for (var i = 0; i < 2; i++) {
+        for (final parent in [
+          fixture.parentSpan(),
+          LegacyInstrumentationSpan(otherTracer),
+        ]) {
+          sut.record(
+            parent,
+            group: 'box',
+            name: 'put',
+            start: fixture.at(i),
+            end: fixture.at(i + 1),
+          );
+        }
+      }
+
+      expect(fixture.tracer.children.single.finished, isFalse);
+      expect(otherTracer.children.single.finished, isFalse);
+
+      sut.flush();
+
+      for (final tracer in [fixture.tracer, otherTracer]) {
+        final span = tracer.children.single;
+        expect(span.finished, isTrue);
+        expect(span.data['db.aggregate.box.put.count'], 2);
+      }
+    });
+
+    test('finishes the oldest summary span above maxParentSpans', () {
+      fixture.options.operationAggregation =
+          SentryOperationAggregation(maxParentSpans: 1);
+      final sut = fixture.getSut()!;
+      final otherTracer = SentryTracer(
+        SentryTransactionContext('other', 'operation'),
+        fixture.hub,
+      );
+
+      sut.record(
+        fixture.parentSpan(),
+        group: 'box',
+        name: 'put',
+        start: fixture.at(0),
+        end: fixture.at(1),
+      );
+      sut.record(
+        LegacyInstrumentationSpan(otherTracer),
+        group: 'box',
+        name: 'put',
+        start: fixture.at(2),
+        end: fixture.at(3),
+      );
+
+      expect(fixture.tracer.children.single.finished, isTrue);
+      expect(otherTracer.children.single.finished, isFalse);
+    });
+
+    test('counts groups above maxGroups as other', () {
+      fixture.options.operationAggregation =
+          SentryOperationAggregation(maxGroups: 1);
+      final sut = fixture.getSut()!;
+      final parent = fixture.parentSpan();
+
+      for (final name in ['put', 'get', 'delete']) {
+        sut.record(
+          parent,
+          group: 'box',
+          name: name,
+          start: fixture.at(0),
+          end: fixture.at(1),
+        );
+      }
+      sut.flush();
+
+      final span = fixture.tracer.children.single;
+      expect(span.data['db.aggregate.box.put.count'], 1);
+      expect(span.data['db.aggregate.other.count'], 2);
+    });
+
+    test('summarizes operations into one span per name', () {
+      final sut = fixture.getSut(spanPerName: true)!;
+      final parent = fixture.parentSpan();
+
+      for (var i = 0; i < 2; i++) {
+        sut.record(
+          parent,
+          group: 'main',
+          name: 'SELECT * FROM t WHERE id = ?',
+          start: fixture.at(i * 1000),
+          end: fixture.at(i * 1000 + 100),
+          rows: 3,
+        );
+      }
+      sut.record(
+        parent,
+        group: 'main',
+        name: 'DELETE FROM t',
+        start: fixture.at(500),
+        end: fixture.at(600),
+        failed: true,
+      );
+      sut.flush();
+
+      final spans = fixture.tracer.children;
+      expect(spans.length, 2);
+
+      final select = spans.first;
+      expect(select.context.description, 'SELECT * FROM t WHERE id = ?');
+      expect(select.status, SpanStatus.ok());
+      expect(select.startTimestamp, fixture.at(0));
+      expect(select.endTimestamp, fixture.at(1100));
+      expect(select.data['db.system'], 'test');
+      expect(select.data['db.name'], 'main');
+      expect(select.data['db.aggregate.count'], 2);
+      expect(select.data['db.aggregate.total_ms'], 0.2);
+      expect(select.data['db.aggregate.rows'], 6);
+
+      final delete = spans.last;
+      expect(delete.context.description, 'DELETE FROM t');
+      expect(delete.status, SpanStatus.internalError());
+      expect(delete.startTimestamp, fixture.at(500));
+      expect(delete.endTimestamp, fixture.at(600));
+      expect(delete.data['db.aggregate.errors'], 1);
+      expect(delete.data.containsKey('db.aggregate.rows'), isFalse);
+    });
+
+    test('finishes the summary span after the interval', () async {
+      fixture.options.operationAggregation = SentryOperationAggregation(
+        interval: Duration(milliseconds: 10),
+      );
+      final sut = fixture.getSut()!;
+
+      sut.record(
+        fixture.parentSpan(),
+        group: 'box',
+        name: 'put',
+        start: fixture.at(0),
+        end: fixture.at(1),
+      );
+      expect(fixture.tracer.children.single.finished, isFalse);
+
+      await Future<void>.delayed(Duration(milliseconds: 50));
+
+      expect(fixture.tracer.children.single.finished, isTrue);
+    });
+
+    test('finishes the summary span with the transaction', () async {
+      final sut = fixture.getSut()!;
+
+      sut.record(
+        fixture.parentSpan(),
+        group: 'box',
+        name: 'put',
+        start: fixture.at(0),
+        end: fixture.at(1),
+      );
+      await fixture.tracer.finish();
+
+      final transaction =
+          fixture.client.captureTransactionCalls.single.transaction;
+      final span = transaction.spans.single;
+      expect(span.finished, isTrue);
+      expect(span.endTimestamp, fixture.at(1));
+      expect(span.data['db.aggregate.box.put.count'], 1);
+    });
+
+    test('finishes the summary span with its parent span', () async {
+      final sut = fixture.getSut()!;
+      final parent = fixture.tracer.startChild('db.sql.transaction');
+
+      sut.record(
+        LegacyInstrumentationSpan(parent),
+        group: 'box',
+        name: 'put',
+        start: fixture.at(0),
+        end: fixture.at(1),
+      );
+      await parent.finish();
+
+      final span = fixture.tracer.children.last;
+      expect(span.context.parentSpanId, parent.context.spanId);
+      expect(span.finished, isTrue);
+      expect(span.data['db.aggregate.box.put.count'], 1);
+    });
+
+    test('run counts the operation and reports failures', () async {
+      final sut = fixture.getSut()!;
+      final parent = fixture.parentSpan();
+      Breadcrumb breadcrumb() => Breadcrumb(message: 'put', data: {});
+      void setSpanData(InstrumentationSpan span) =>
+          span.setData('db.name', 'box');
+
+      final result = await sut.run(
+        parent,
+        group: 'box',
+        name: 'put',
+        execute: () async => 1,
+        setSpanData: setSpanData,
+        breadcrumb: breadcrumb,
+      );
+      await expectLater(
+        sut.run<int>(
+          parent,
+          group: 'box',
+          name: 'put',
+          description: 'put a',
+          execute: () async => throw Exception('fixture-exception'),
+          setSpanData: setSpanData,
+          breadcrumb: breadcrumb,
+        ),
+        throwsException,
+      );
+      sut.flush();
+
+      expect(result, 1);
+      final spans = fixture.tracer.children;
+      expect(spans.length, 2);
+      final summary = spans.first;
+      expect(summary.data['db.aggregate.box.put.count'], 2);
+      expect(summary.data['db.aggregate.box.put.errors'], 1);
+      final failure = spans.last;
+      expect(failure.context.description, 'put a');
+      expect(failure.origin, 'auto.db.test');
+      expect(failure.status, SpanStatus.internalError());
+      expect(failure.throwable, isException);
+      expect(failure.data['db.name'], 'box');
+      expect(failure.finished, isTrue);
+      final crumb = fixture.hub.scope.breadcrumbs.single;
+      expect(crumb.data?['status'], 'internal_error');
+      expect(crumb.level, SentryLevel.warning);
+    });
+
+    test('runSync counts the operation and reports outliers', () async {
+      fixture.options.operationAggregation = SentryOperationAggregation(
+        outlierThreshold: Duration.zero,
+      );
+      final sut = fixture.getSut()!;
+
+      final result = sut.runSync(
+        fixture.parentSpan(),
+        group: 'box',
+        name: 'get',
+        origin: 'auto.db.other',
+        execute: () => 'value',
+        breadcrumb: () => Breadcrumb(message: 'get', data: {}),
+      );
+      await Future<void>.delayed(Duration.zero);
+      sut.flush();
+
+      expect(result, 'value');
+      final spans = fixture.tracer.children;
+      expect(spans.first.data['db.aggregate.box.get.count'], 1);
+      expect(spans.last.origin, 'auto.db.other');
+      expect(spans.last.status, SpanStatus.ok());
+      expect(fixture.hub.scope.breadcrumbs.single.data?['status'], 'ok');
+    });
+  });
+}
+
+class Fixture {
+  final options = defaultTestOptions()
+    ..tracesSampleRate = 1.0
+    ..operationAggregation = SentryOperationAggregation();
+  final client = MockSentryClient();
+  late final hub = Hub(options)..bindClient(client);
+  late final tracer = SentryTracer(
+    SentryTransactionContext(
+      'name',
+      'operation',
+      samplingDecision: SentryTracesSamplingDecision(true),
+    ),
+    hub,
+  );
+  final _start = DateTime.now().toUtc();
+
+  DateTime at(int micros) => _start.add(Duration(microseconds: micros));
+
+  InstrumentationSpan parentSpan() => LegacyInstrumentationSpan(tracer);
+
+  OperationAggregator? getSut({
+    String operation = 'db',
+    String system = 'test',
+    bool spanPerName = false,
+  }) =>
+      OperationAggregator.of(
+        hub,
+        operation: operation,
+        system: system,
+        origin: 'auto.db.$system',
+        spanPerName: spanPerName,
+      );
+}
@@ -0,0 +1,85 @@
+import 'package:sentry/sentry.dart';
+import 'package:test/test.dart';
+
+void main() {
+  group('$SqlFingerprinter', () {
+    String normalize(String sql) => SqlFingerprinter.normalize(sql);
+
+    test('replaces string literals', () {
+      expect(
+        normalize("SELECT * FROM users WHERE name = 'O''Brien'"),
+        'SELECT * FROM users WHERE name = ?',
+      );
+    });
+
+    test('replaces numeric and blob literals', () {
+      expect(
+        normalize("UPDATE t SET a = 1, b = -2.5e10, c = 0xFF, d = X'00ff'"),
+        'UPDATE t SET a = ?, b = -?, c = ?, d = ?',
+      );
+    });
+
+    test('replaces bind parameters', () {
+      expect(
+        normalize(r'SELECT * FROM t WHERE a = ?1 AND b = :b AND c = @c OR $d'),
+        'SELECT * FROM t WHERE a = ? AND b = ? AND c = ? OR ?',
+      );
+    });
+
+    test('keeps identifiers and quoted identifiers', () {
+      expect(
+        normalize('SELECT "col 1", [col 2], `col3`, table1.x2 FROM table1'),
+        'SELECT "col 1", [col 2], `col3`, table1.x2 FROM table1',
+      );
+    });
+
+    test('collapses IN lists', () {
+      expect(
+        normalize('SELECT * FROM t WHERE id IN (1, 2, 3) AND x not in (?,?)'),
+        'SELECT * FROM t WHERE id IN (?) AND x not in (?)',
+      );
+    });
+
+    test('collapses repeated VALUES rows', () {
+      expect(
+        normalize("INSERT INTO t (a, b) VALUES (1, 'a'), (2, 'b'), (3, 'c')"),
+        'INSERT INTO t (a, b) VALUES (?, ?)',
+      );
+    });
+
+    test('removes comments and collapses whitespace', () {
+      expect(
+        normalize('SELECT a -- the a\n  FROM /* the table */ t\n\tWHERE a=1'),
+        'SELECT a FROM t WHERE a=?',
+      );
+    });
+
+    test('statements that only differ in literals share a fingerprint', () {
+      final sut = SqlFingerprinter();
+
+      expect(
+        sut.fingerprint('SELECT * FROM t WHERE id = 1'),
+        sut.fingerprint('SELECT * FROM t WHERE id = 42'),
+      );
+    });
+
+    test('caches fingerprints up to cacheSize', () {
+      final sut = SqlFingerprinter(cacheSize: 2);
+
+      sut.fingerprint('SELECT 1');
+      sut.fingerprint('SELECT 2');
+      sut.fingerprint('SELECT 1');
+      sut.fingerprint('SELECT 3');
+
+      expect(sut.cachedCount, 2);
+    });
+
+    test('does not cache long statements', () {
+      final sut = SqlFingerprinter();
+      final sql = 'SELECT ${'a' * SqlFingerprinter.maxCachedLength}';
+
+      expect(sut.fingerprint(sql), sql);
+      expect(sut.cachedCount, 0);
+    });
+  });
+}
@@ -0,0 +1,120 @@
+// ignore_for_file: invalid_use_of_internal_member
+
+import 'package:sentry/sentry.dart';
+import 'package:test/test.dart';
+
+import '../mocks/mock_transport.dart';
+import '../test_utils.dart';
+
+void main() {
+  group(SdkOverheadStats, () {
+    late SentryOptions options;
+
+    setUp(() {
+      options = defaultTestOptions();
+    });
+
+    test('does not measure when disabled', () {
+      final sut = options.sdkOverheadStats;
+
+      expect(sut.start(SdkOverheadStage.serialization), isNull);
+      sut.record(SdkOverheadStage.serialization, 10);
+      expect(sut.measure(SdkOverheadStage.serialization, () => 42), 42);
+
+      expect(sut.snapshot(), isEmpty);
+    });
+
+    test('records count, total, max and histogram per stage', () {
+      options.enableSdkOverheadStats = true;
+      final sut = options.sdkOverheadStats;
+
+      sut.record(SdkOverheadStage.beforeSend, 0);
+      sut.record(SdkOverheadStage.beforeSend, 3);
+      sut.record(SdkOverheadStage.beforeSend, 100);
+
+      final stats = sut.snapshot().single;
+      expect(stats.stage, SdkOverheadStage.beforeSend);
+      expect(stats.count, 3);
+      expect(stats.totalMicros, 103);
+      expect(stats.maxMicros, 100);
+      expect(stats.buckets.length, SdkOverheadStats.bucketCount);
+      expect(stats.buckets[0], 1); // 0us
+      expect(stats.buckets[2], 1); // 2us to 3us
+      expect(stats.buckets[7], 1); // 64us to 127us
+    });
+
+    test('puts long durations into the last bucket', () {
+      options.enableSdkOverheadStats = true;
+      final sut = options.sdkOverheadStats;
+
+      sut.record(SdkOverheadStage.screenshot, 1 << 30);
+
+      final stats = sut.snapshot().single;
+      expect(stats.buckets.last, 1);
+    });
+
+    test('estimates percentiles from the histogram', () {
+      options.enableSdkOverheadStats = true;
+      final sut = options.sdkOverheadStats;
+
+      for (var i = 0; i < 99; i++) {
+        sut.record(SdkOverheadStage.serialization, 10);
+      }
+      sut.record(SdkOverheadStage.serialization, 5000);
+
+      final stats = sut.snapshot().single;
+      expect(stats.percentileMicros(0.5), 16);
+      expect(stats.percentileMicros(0.99), 16);
+      expect(stats.percentileMicros(1), 5000);
+      expect(stats.toJson(), {
+        'stage': 'serialization',
+        'count': 100,
+        'total_us': 5990,
+        'max_us': 5000,
+        'p50_us': 16,
+        'p95_us': 16,
+        'p99_us': 16,
+      });
+    });
+
+    test('measure records the stage', () {
+      options.enableSdkOverheadStats = true;
+      final sut = options.sdkOverheadStats;
+
+      sut.measure(SdkOverheadStage.compression, () {});
+      sut.start(SdkOverheadStage.compression)!.stop();
+
+      expect(sut.snapshot().single.count, 2);
+    });
+
+    test('reset clears all stages', () {
+      options.enableSdkOverheadStats = true;
+      final sut = options.sdkOverheadStats;
+      sut.record(SdkOverheadStage.compression, 1);
+
+      sut.reset();
+
+      expect(sut.snapshot(), isEmpty);
+    });
+
+    test('captureEvent records event processors and beforeSend', () async {
+      options
+        ..enableSdkOverheadStats = true
+        ..transport = MockTransport()
+        ..beforeSend = (event, hint) => event;
+      final client = SentryClient(options);
+
+      await client.captureEvent(SentryEvent());
+      final stages =
+          options.sdkOverheadStats.snapshot().map((stats) => stats.stage);
+
+      expect(
+        stages,
+        containsAll([
+          SdkOverheadStage.eventProcessors,
+          SdkOverheadStage.beforeSend,
+        ]),
+      );
+    });
+  });
+}
@@ -0,0 +1,155 @@
+@TestOn('vm')
+library;
+
+import 'dart:convert';
+import 'dart:io';
+import 'dart:isolate';
+
+import 'package:http/http.dart' as http;
+import 'package:http/testing.dart';
+import 'package:sentry/sentry.dart';
+import 'package:sentry/src/transport/http_transport.dart';
+import 'package:sentry/src/transport/rate_limiter.dart';
+import 'package:sentry/src/utils/worker_pool.dart';
+import 'package:test/test.dart';
+
+import '../test_utils.dart';
+
+void main() {
+  group(WorkerPool, () {
+    late WorkerPool sut;
+
+    tearDown(() async {
+      await sut.close();
+    });
+
+    test('runs tasks and returns their bytes', () async {
+      sut = WorkerPool(size: 2);
+
+      final results = await Future.wait(
+        List.generate(10, (i) => sut.run(_encodeNumber, i)),
+      );
+
+      expect(
+        results.map(utf8.decode),
+        List.generate(10, (i) => '$i'),
+      );
+    });
+
+    test('runs tasks on another isolate', () async {
+      sut = WorkerPool(size: 1);
+
+      final name = await sut.run(_isolateName, null);
+
+      expect(utf8.decode(name), 'SentryWorkerPool');
+    });
+
+    test('runs tasks inline without workers', () async {
+      sut = WorkerPool(size: 0);
+
+      final name = await sut.run(_isolateName, null);
+
+      expect(sut, isA<InlineWorkerPool>());
+      expect(utf8.decode(name), isNot('SentryWorkerPool'));
+    });
+
+    test('runs tasks inline when the message is not sendable', () async {
+      sut = WorkerPool(size: 1);
+      final port = RawReceivePortHolder();
+
+      final result = await sut.run(_encodeHolder, port);
+      port.close();
+
+      expect(utf8.decode(result), 'holder');
+    });
+
+    test('runs tasks inline when the queues are full', () async {
+      sut = WorkerPool(size: 1, maxQueuedPerWorker: 2);
+
+      // All tasks are started while the worker is spawned.
+      final names = await Future.wait(
+        List.generate(5, (_) => sut.run(_isolateName, null)),
+      );
+
+      expect(
+        names.map(utf8.decode).where((name) => name == 'SentryWorkerPool'),
+        hasLength(2),
+      );
+    });
+
+    test('forwards task errors', () async {
+      sut = WorkerPool(size: 1);
+
+      await expectLater(sut.run(_throw, null), throwsA(anything));
+    });
+
+    test('runs tasks inline after close', () async {
+      sut = WorkerPool(size: 1);
+      await sut.close();
+
+      final name = await sut.run(_isolateName, null);
+
+      expect(utf8.decode(name), isNot('SentryWorkerPool'));
+    });
+  });
+
+  group('$HttpTransport with envelopeWorkerCount', () {
+    late SentryOptions options;
+
+    setUp(() {
+      options = defaultTestOptions()..envelopeWorkerCount = 2;
+    });
+
+    tearDown(() async {
+      await options.workerPool.close();
+    });
+
+    for (final compressPayload in [true, false]) {
+      test('sends the same body, compressPayload: $compressPayload', () async {
+        List<int>? body;
+        Map<String, String>? headers;
+        options
+          ..compressPayload = compressPayload
+          ..httpClient = MockClient((http.Request request) async {
+            body = request.bodyBytes;
+            headers = request.headers;
+            return http.Response('{}', 200);
+          });
+        final sut = HttpTransport(options, RateLimiter(options));
+
+        final envelope = SentryEnvelope.fromEvent(
+          SentryEvent(message: SentryMessage('fixture-message')),
+          options.sdk,
+          dsn: options.dsn,
+        );
+        await sut.send(envelope);
+
+        final envelopeData = <int>[];
+        await envelope.envelopeStream(options).forEach(envelopeData.addAll);
+
+        if (compressPayload) {
+          expect(headers?['Content-Encoding'], 'gzip');
+          expect(gzip.decode(body!), envelopeData);
+        } else {
+          expect(headers?['Content-Encoding'], isNull);
+          expect(body, envelopeData);
+        }
+      });
+    }
+  });
+}
+
+List<int> _encodeNumber(int number) => utf8.encode('$number');
+
+List<int> _isolateName(Object? _) => utf8.encode(Isolate.current.debugName!);
+
+List<int> _encodeHolder(RawReceivePortHolder holder) => utf8.encode('holder');
+
+List<int> _throw(Object? _) => throw StateError('fixture-error');
+
+/// Holds a [RawReceivePort], which cannot be sent to another isolate.
+class RawReceivePortHolder {
+  final port = RawReceivePort();
+
+  void close() => port.close();
+}
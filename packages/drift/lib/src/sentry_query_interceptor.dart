@@ -52,6 +52,19 @@ class SentryQueryInterceptor extends QueryInterceptor {
         operation: operation,
       );
 
+  /// Wraps a single SQL statement, see [SentrySpanHelper.asyncWrapStatement].
+  Future<T> _instrumentStatement<T>(
+    String statement,
+    Future<T> Function() execute, {
+    int? Function(T result)? rowsOf,
+  }) =>
+      _spanHelper.asyncWrapStatement<T>(
+        statement,
+        execute,
+        dbName: _dbName,
+        rowsOf: rowsOf,
+      );
+
   @override
   Future<bool> ensureOpen(QueryExecutor executor, QueryExecutorUser user) {
     if (_isDbOpen) {
@@ -115,7 +128,7 @@ class SentryQueryInterceptor extends QueryInterceptor {
     String statement,
     List<Object?> args,
   ) {
-    return _instrumentOperation(
+    return _instrumentStatement(
       statement,
       () => executor.runInsert(statement, args),
     );
@@ -127,9 +140,10 @@ class SentryQueryInterceptor extends QueryInterceptor {
     String statement,
     List<Object?> args,
   ) {
-    return _instrumentOperation(
+    return _instrumentStatement(
       statement,
       () => executor.runUpdate(statement, args),
+      rowsOf: (rows) => rows,
     );
   }
 
@@ -139,9 +153,10 @@ class SentryQueryInterceptor extends QueryInterceptor {
     String statement,
     List<Object?> args,
   ) {
-    return _instrumentOperation(
+    return _instrumentStatement(
       statement,
       () => executor.runDelete(statement, args),
+      rowsOf: (rows) => rows,
     );
   }
 
@@ -151,7 +166,7 @@ class SentryQueryInterceptor extends QueryInterceptor {
     String statement,
     List<Object?> args,
   ) {
-    return _instrumentOperation(
+    return _instrumentStatement(
       statement,
       () => executor.runCustom(statement, args),
     );
@@ -163,9 +178,10 @@ class SentryQueryInterceptor extends QueryInterceptor {
     String statement,
     List<Object?> args,
   ) {
-    return _instrumentOperation(
+    return _instrumentStatement(
       statement,
       () => executor.runSelect(statement, args),
+      rowsOf: (rows) => rows.length,
     );
   }
 }
@@ -84,6 +84,51 @@ class SentrySpanHelper {
     }
   }
 
+  /// Wraps a single SQL [statement] like [asyncWrapInSpan].
+  ///
+  /// With [SentryOptions.operationAggregation], the statement is counted in
+  /// the summary span of its fingerprint instead, and only gets a span of its
+  /// own if it fails or is an outlier. [rowsOf] returns the number of rows
+  /// returned or affected by the statement.
+  Future<T> asyncWrapStatement<T>(
+    String statement,
+    Future<T> Function() execute, {
+    String? dbName,
+    int? Function(T result)? rowsOf,
+  }) async {
+    final aggregator = _aggregator();
+    if (aggregator == null) {
+      return asyncWrapInSpan(statement, execute, dbName: dbName);
+    }
+
+    return aggregator.run(
+      _getParent(),
+      group: dbName ?? SentrySpanData.dbSystemSqlite,
+      name: SqlFingerprinter.shared.fingerprint(statement),
+      description: statement,
+      origin: _origin,
+      execute: execute,
+      rowsOf: rowsOf,
+      setSpanData: (span) {
+        span.setData(
+          SentrySpanData.dbSystemKey,
+          SentrySpanData.dbSystemSqlite,
+        );
+        if (dbName != null) {
+          span.setData(SentrySpanData.dbNameKey, dbName);
+        }
+      },
+    );
+  }
+
+  OperationAggregator? _aggregator() => OperationAggregator.of(
+        _hub,
+        operation: SentrySpanOperations.dbSqlQuery,
+        system: SentrySpanData.dbSystemSqlite,
+        origin: _origin,
+        spanPerName: true,
+      );
+
   T beginTransaction<T>(
     T Function() execute, {
     String? dbName,
@@ -142,6 +187,8 @@ class SentrySpanHelper {
     }
 
     final parentSpan = _transactionStack.last;
+    // The summary spans of the statements end before the transaction span.
+    _aggregator()?.flush();
 
     try {
       final result = await execute();
@@ -168,6 +215,8 @@ class SentrySpanHelper {
     }
 
     final parentSpan = _transactionStack.last;
+    // The summary spans of the statements end before the transaction span.
+    _aggregator()?.flush();
 
     try {
       final result = await execute();
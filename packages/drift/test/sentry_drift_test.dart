@@ -719,6 +719,75 @@ void main() {
     });
   });
 
+  group('with operation aggregation', () {
+    setUp(() {
+      // Only failures are reported on their own, regardless of timing.
+      fixture.options.operationAggregation = SentryOperationAggregation(
+        outlierThreshold: Duration(minutes: 1),
+      );
+    });
+
+    void flush() => OperationAggregator.of(
+          HubAdapter(),
+          operation: SentrySpanOperations.dbSqlQuery,
+          system: SentrySpanData.dbSystemSqlite,
+          origin: SentryTraceOrigins.autoDbDriftQueryInterceptor,
+          spanPerName: true,
+        )!
+            .flush();
+
+    test('summarizes statements per fingerprint', () async {
+      final sut = fixture.getSut();
+      final db = AppDatabase(NativeDatabase.memory().interceptWith(sut));
+
+      final tx = _startTransaction();
+      await _insertRow(db);
+      await _insertRow(db);
+      await _insertRow(db);
+      await db.select(db.todoItems).get();
+      flush();
+
+      final insertSpan = tx.children.singleWhere(
+        (span) => span.context.description == expectedInsertStatement,
+      );
+      _verifySpan(expectedInsertStatement, insertSpan);
+      expect(insertSpan.data['db.aggregate.count'], 3);
+
+      final selectSpan = tx.children.singleWhere(
+        (span) => span.context.description == expectedSelectStatement,
+      );
+      _verifySpan(expectedSelectStatement, selectSpan);
+      expect(selectSpan.data['db.aggregate.count'], 1);
+      expect(selectSpan.data['db.aggregate.rows'], 3);
+    });
+
+    test('reports failed statements on their own', () async {
+      final exception = Exception('test');
+      final queryExecutor = MockQueryExecutor();
+      when(queryExecutor.ensureOpen(any)).thenAnswer((_) => Future.value(true));
+      when(queryExecutor.runInsert(any, any)).thenThrow(exception);
+      when(queryExecutor.dialect).thenReturn(SqlDialect.sqlite);
+
+      final sut = fixture.getSut();
+      final db = AppDatabase(queryExecutor.interceptWith(sut));
+
+      final tx = _startTransaction();
+      try {
+        await _insertRow(db);
+      } catch (e) {
+        // making sure the thrown exception doesn't fail the test
+      }
+      flush();
+
+      final spans = tx.children.where(
+        (span) => span.context.description == expectedInsertStatement,
+      );
+      expect(spans.length, 2);
+      expect(spans.first.data['db.aggregate.errors'], 1);
+      _verifyErrorSpan(expectedInsertStatement, exception, spans.last);
+    });
+  });
+
   group('integrations', () {
     setUp(() async {
       // init the interceptor so the integrations are added
@@ -789,6 +858,7 @@ class _NullSpanFactory implements InstrumentationSpanFactory {
     required InstrumentationSpan parentSpan,
     required String operation,
     String? description,
+    DateTime? startTimestamp,
   }) {
     // Always return null to simulate span creation failure
     return null;
@@ -0,0 +1,151 @@
+// ignore_for_file: invalid_use_of_internal_member
+
+// Measures what the SentryFile stream instrumentation adds per chunk, compared
+// to plain dart:io.
+//
+// Usage: dart run benchmark/stream_benchmark.dart [--json=<path>]
+//
+// The in-memory benchmarks isolate the cost per chunk, the file benchmarks
+// show it next to real I/O. The results use the format of the `sentry`
+// package benchmarks (packages/dart/benchmark).
+
+import 'dart:convert';
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:sentry/sentry.dart';
+import 'package:sentry_file/sentry_file.dart';
+import 'package:sentry_file/src/sentry_file_stream.dart';
+
+const _chunkCount = 10000;
+const _fileSize = 16 * 1024 * 1024;
+const _duration = Duration(seconds: 2);
+
+Future<void> main(List<String> args) async {
+  String? jsonPath;
+  for (final arg in args) {
+    if (arg.startsWith('--json=')) {
+      jsonPath = arg.substring('--json='.length);
+    } else {
+      stderr.writeln('Unknown argument: $arg');
+      exit(64);
+    }
+  }
+
+  final options = SentryOptions(dsn: 'https://abc@def.ingest.sentry.io/1234')
+    ..tracesSampleRate = 1.0
+    ..transport = _NullTransport();
+  final hub = Hub(options);
+
+  // Every instrumented stream runs in a transaction of its own, a single one
+  // would stop taking spans at `maxSpans`. The instrumented results include
+  // starting the transaction and the span of the stream.
+  Future<void> Function() traced(Future<void> Function() op) => () {
+        hub.startTransaction('benchmark', 'benchmark', bindToScope: true);
+        return op();
+      };
+
+  final directory = await Directory.systemTemp.createTemp('sentry_file_bench');
+  final file = File('${directory.path}/data.bin');
+  await file.writeAsBytes(Uint8List(_fileSize));
+  final sentryFile = SentryFile(file, hub: hub);
+
+  final chunk = Uint8List(1024);
+  final chunks = List<List<int>>.filled(_chunkCount, chunk);
+
+  final results = <String, double>{};
+  Future<void> run(String name, Future<void> Function() op) async {
+    final microsPerOp = await _measure(op);
+    results[name] = microsPerOp;
+    stdout.writeln('$name: ${microsPerOp.toStringAsFixed(3)}us/op');
+  }
+
+  // Per chunk: the same chunks, once through a plain stream and once through
+  // the instrumented one.
+  await run('stream $_chunkCount chunks raw', () async {
+    await Stream<List<int>>.fromIterable(chunks).drain<void>();
+  });
+  await run(
+    'stream $_chunkCount chunks instrumented',
+    traced(() async {
+      final tracker = SentryFileStreamTracker(
+        hub,
+        operation: 'file.read',
+        description: 'benchmark',
+      );
+      await instrumentReadStream(
+        Stream<List<int>>.fromIterable(chunks),
+        tracker,
+      ).drain<void>();
+    }),
+  );
+
+  await run('openRead 16MiB raw', () => file.openRead().drain<void>());
+  await run(
+    'openRead 16MiB SentryFile',
+    traced(() => sentryFile.openRead().drain<void>()),
+  );
+
+  Future<void> write(File target) async {
+    final sink = target.openWrite();
+    for (var i = 0; i < 256; i++) {
+      sink.add(chunk);
+    }
+    await sink.close();
+  }
+
+  final target = File('${directory.path}/write.bin');
+  await run('openWrite 256KiB raw', () => write(target));
+  await run(
+    'openWrite 256KiB SentryFile',
+    traced(() => write(SentryFile(target, hub: hub))),
+  );
+
+  final overhead = (results['stream $_chunkCount chunks instrumented']! -
+          results['stream $_chunkCount chunks raw']!) /
+      _chunkCount;
+  stdout.writeln(
+    'Added cost per chunk, including the amortized span: '
+    '${(overhead * 1000).round()}ns',
+  );
+
+  await directory.delete(recursive: true);
+
+  if (jsonPath != null) {
+    final json = {
+      'dart': Platform.version,
+      'os': Platform.operatingSystem,
+      'benchmarks': {
+        for (final entry in results.entries)
+          entry.key: {'us_per_op': entry.value},
+      },
+    };
+    await File(jsonPath).writeAsString(
+      '${const JsonEncoder.withIndent('  ').convert(json)}\n',
+    );
+  }
+  exit(0);
+}
+
+Future<double> _measure(Future<void> Function() op) async {
+  // Warm up, so the measured code is optimized by the JIT.
+  final warmUp = Stopwatch()..start();
+  while (warmUp.elapsed < _duration ~/ 5) {
+    await op();
+  }
+
+  final stopwatch = Stopwatch()..start();
+  var iterations = 0;
+  while (stopwatch.elapsed < _duration) {
+    await op();
+    iterations++;
+  }
+  return stopwatch.elapsedMicroseconds / iterations;
+}
+
+/// Accepts every envelope without encoding or sending it.
+class _NullTransport implements Transport {
+  @override
+  Future<SentryId?> send(SentryEnvelope envelope) async =>
+      envelope.header.eventId;
+}
@@ -210,6 +210,7 @@ import 'dart:typed_data';
 import 'package:meta/meta.dart';
 import 'package:sentry/sentry.dart';
 
+import 'sentry_file_stream.dart';
 import 'version.dart';
 
 typedef Callback<T> = FutureOr<T> Function();
@@ -233,7 +234,9 @@ typedef Callback<T> = FutureOr<T> Function();
 /// ```
 ///
 /// All the copy, create, delete, open, rename, read, and write operations are
-/// supported.
+/// supported. Streams from [openRead] and sinks from [openWrite] get a single
+/// span with the number of bytes and chunks, the time to the first byte and
+/// the throughput, once they are done.
 class SentryFile implements File {
   SentryFile(
     this._file, {
@@ -289,33 +292,48 @@ class SentryFile implements File {
     return _wrap(() async => _file.open(mode: mode), 'file.open');
   }
 
-  // coverage:ignore-start
-
   @override
   Stream<List<int>> openRead([int? start, int? end]) {
-    return _file.openRead(start, end);
+    return instrumentReadStream(
+      _file.openRead(start, end),
+      _streamTracker('file.read'),
+    );
   }
 
+  // coverage:ignore-start
+
   @override
   RandomAccessFile openSync({FileMode mode = FileMode.read}) {
     return _file.openSync(mode: mode);
   }
 
+  // coverage:ignore-end
+
   @override
   IOSink openWrite({FileMode mode = FileMode.write, Encoding encoding = utf8}) {
-    return _file.openWrite(mode: mode, encoding: encoding);
+    return instrumentWriteSink(
+      _file.openWrite(mode: mode, encoding: encoding),
+      encoding,
+      _streamTracker('file.write'),
+    );
   }
 
-  // coverage:ignore-end
-
   @override
   Future<Uint8List> readAsBytes() {
-    return _wrap(() async => _file.readAsBytes(), 'file.read');
+    return _wrap(
+      () async => _file.readAsBytes(),
+      'file.read',
+      sizeOf: (bytes) => bytes.length,
+    );
   }
 
   @override
   Uint8List readAsBytesSync() {
-    return _wrapSync(() => _file.readAsBytesSync(), 'file.read');
+    return _wrapSync(
+      () => _file.readAsBytesSync(),
+      'file.read',
+      sizeOf: (bytes) => bytes.length,
+    );
   }
 
   @override
@@ -416,11 +434,26 @@ class SentryFile implements File {
     );
   }
 
+  SentryFileStreamTracker _streamTracker(String operation) {
+    return SentryFileStreamTracker(
+      _hub,
+      operation: operation,
+      description: _getDesc(),
+      path: _hub.options.sendDefaultPii ? absolute.path : null,
+    );
+  }
+
   String _getDesc() {
     return uri.pathSegments.isNotEmpty ? uri.pathSegments.last : path;
   }
 
-  Future<T> _wrap<T>(Callback<T> callback, String operation) async {
+  /// [sizeOf] returns the file size from the result of [callback], which
+  /// saves looking up the length of the file.
+  Future<T> _wrap<T>(
+    Callback<T> callback,
+    String operation, {
+    int? Function(T data)? sizeOf,
+  }) async {
     final desc = _getDesc();
 
     final parentSpan = _spanFactory.getSpan(_hub);
@@ -447,17 +480,21 @@ class SentryFile implements File {
       // workaround for having the length when the file does not exist
       // or its being deleted.
       int? length;
-      var hasLength = false;
-      try {
-        length = await _file.length();
-        hasLength = true;
-      } catch (_) {
-        // ignore in case something goes wrong
+      var hasLength = sizeOf != null;
+      if (!hasLength) {
+        try {
+          length = await _file.length();
+          hasLength = true;
+        } catch (_) {
+          // ignore in case something goes wrong
+        }
       }
 
       data = await callback();
 
-      if (!hasLength) {
+      if (sizeOf != null) {
+        length = sizeOf(data);
+      } else if (!hasLength) {
         try {
           length = await _file.length();
         } catch (_) {
@@ -489,7 +526,11 @@ class SentryFile implements File {
     return data;
   }
 
-  T _wrapSync<T>(Callback<T> callback, String operation) {
+  T _wrapSync<T>(
+    Callback<T> callback,
+    String operation, {
+    int? Function(T data)? sizeOf,
+  }) {
     final desc = _getDesc();
 
     final parentSpan = _spanFactory.getSpan(_hub);
@@ -518,17 +559,21 @@ class SentryFile implements File {
       // workaround for having the length when the file does not exist
       // or its being deleted.
       int? length;
-      var hasLength = false;
-      try {
-        length = _file.lengthSync();
-        hasLength = true;
-      } catch (_) {
-        // ignore in case something goes wrong
+      var hasLength = sizeOf != null;
+      if (!hasLength) {
+        try {
+          length = _file.lengthSync();
+          hasLength = true;
+        } catch (_) {
+          // ignore in case something goes wrong
+        }
       }
 
       data = callback() as T;
 
-      if (!hasLength) {
+      if (sizeOf != null) {
+        length = sizeOf(data);
+      } else if (!hasLength) {
         try {
           length = _file.lengthSync();
         } catch (_) {
@@ -0,0 +1,205 @@
+// ignore_for_file: invalid_use_of_internal_member
+
+import 'dart:async';
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:meta/meta.dart';
+import 'package:sentry/sentry.dart';
+
+/// Counts the bytes and chunks that go through a file stream and reports
+/// them with a single span and breadcrumb once the stream is done.
+///
+/// Chunks are only counted, never copied or buffered, so the cost per chunk
+/// is a few additions.
+@internal
+class SentryFileStreamTracker {
+  SentryFileStreamTracker(
+    this._hub, {
+    required this.operation,
+    required this.description,
+    String? path,
+  })  : _path = path,
+        _parentSpan = _hub.options.spanFactory.getSpan(_hub);
+
+  final Hub _hub;
+  final String operation;
+  final String description;
+  final String? _path;
+  final InstrumentationSpan? _parentSpan;
+
+  InstrumentationSpan? _span;
+  DateTime? _start;
+  DateTime? _firstChunk;
+  Object? _error;
+  bool _finished = false;
+
+  int bytes = 0;
+  int chunks = 0;
+
+  /// Starts the span, when the stream starts reading or writing.
+  void start() {
+    if (_start != null) {
+      return;
+    }
+    final start = _start = _hub.options.clock();
+    final parentSpan = _parentSpan;
+    final span = _span = parentSpan != null
+        ? _hub.options.spanFactory.createSpan(
+            parentSpan: parentSpan,
+            operation: operation,
+            description: description,
+            startTimestamp: start,
+          )
+        : null;
+    span?.origin = SentryTraceOrigins.autoFile;
+    span?.setData('file.async', true);
+    if (_path != null) {
+      span?.setData('file.path', _path);
+    }
+  }
+
+  void add(List<int> chunk) {
+    if (chunks == 0) {
+      _firstChunk = _hub.options.clock();
+    }
+    chunks++;
+    bytes += chunk.length;
+  }
+
+  void fail(Object error) {
+    _error ??= error;
+  }
+
+  /// Finishes the span and adds the breadcrumb. Only the first call has an
+  /// effect, later ones come from cancelling a stream that is already done.
+  Future<void> finish({bool cancelled = false}) async {
+    if (_finished) {
+      return;
+    }
+    _finished = true;
+    start();
+
+    final end = _hub.options.clock();
+    final data = <String, dynamic>{
+      'file.async': true,
+      if (_path != null) 'file.path': _path,
+      'file.size': bytes,
+      'file.chunk_count': chunks,
+    };
+    final firstChunk = _firstChunk;
+    if (firstChunk != null) {
+      data['file.time_to_first_byte_ms'] =
+          firstChunk.difference(_start!).inMicroseconds / 1000;
+    }
+    final micros = end.difference(_start!).inMicroseconds;
+    if (micros > 0) {
+      data['file.bytes_per_second'] =
+          (bytes * Duration.microsecondsPerSecond / micros).round();
+    }
+
+    final span = _span;
+    if (span != null) {
+      data.forEach(span.setData);
+      final error = _error;
+      if (error != null) {
+        span.throwable = error;
+        span.status = SpanStatus.internalError();
+      } else {
+        span.status = cancelled ? SpanStatus.cancelled() : SpanStatus.ok();
+      }
+      await span.finish(endTimestamp: end);
+    }
+
+    await _hub.addBreadcrumb(
+      Breadcrumb(
+        message: description,
+        data: data,
+        category: operation,
+      ),
+    );
+  }
+}
+
+/// Returns a stream with the chunks of [source], which are counted by
+/// [tracker]. The span starts when the stream is listened to and finishes
+/// when it is done or cancelled.
+@internal
+Stream<List<int>> instrumentReadStream(
+  Stream<List<int>> source,
+  SentryFileStreamTracker tracker,
+) {
+  late StreamSubscription<List<int>> subscription;
+  // Synchronous, so chunks are passed on as they arrive, without another
+  // microtask per chunk.
+  final controller = StreamController<List<int>>(sync: true);
+  controller
+    ..onListen = () {
+      tracker.start();
+      subscription = source.listen(
+        (chunk) {
+          tracker.add(chunk);
+          controller.add(chunk);
+        },
+        onError: (Object error, StackTrace stackTrace) {
+          tracker.fail(error);
+          controller.addError(error, stackTrace);
+        },
+        onDone: () {
+          unawaited(tracker.finish());
+          controller.close();
+        },
+      );
+    }
+    ..onPause = () => subscription.pause()
+    ..onResume = () => subscription.resume()
+    ..onCancel = () {
+      unawaited(tracker.finish(cancelled: true));
+      return subscription.cancel();
+    };
+  return controller.stream;
+}
+
+/// Returns an [IOSink] that writes to [sink] and counts the written chunks
+/// with [tracker]. The span finishes when the sink is closed.
+@internal
+IOSink instrumentWriteSink(
+  IOSink sink,
+  Encoding encoding,
+  SentryFileStreamTracker tracker,
+) {
+  tracker.start();
+  return IOSink(_CountingConsumer(sink, tracker), encoding: encoding);
+}
+
+class _CountingConsumer implements StreamConsumer<List<int>> {
+  _CountingConsumer(this._sink, this._tracker);
+
+  final IOSink _sink;
+  final SentryFileStreamTracker _tracker;
+
+  @override
+  Future<void> addStream(Stream<List<int>> stream) async {
+    try {
+      await _sink.addStream(stream.map((chunk) {
+        _tracker.add(chunk);
+        return chunk;
+      }));
+    } catch (error) {
+      _tracker.fail(error);
+      rethrow;
+    }
+  }
+
+  @override
+  Future<void> close() async {
+    try {
+      await _sink.close();
+    } catch (error) {
+      _tracker.fail(error);
+      rethrow;
+    } finally {
+      await _tracker.finish();
+    }
+  }
+}
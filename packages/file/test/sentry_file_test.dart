@@ -583,6 +583,128 @@ void main() {
     });
   });
 
+  group('$SentryFile streams', () {
+    late Fixture fixture;
+
+    setUp(() {
+      fixture = Fixture();
+    });
+
+    test('openRead adds one span for the stream', () async {
+      final file = File('test_resources/sentry.png');
+
+      final sut = fixture.getSut(
+        file,
+        sendDefaultPii: true,
+        tracesSampleRate: 1.0,
+      );
+
+      final tr = fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+      final chunks = await sut.openRead().toList();
+
+      await tr.finish();
+
+      final call = fixture.client.captureTransactionCalls.first;
+      final span = call.transaction.spans.single;
+      expect(span.context.operation, 'file.read');
+      expect(span.context.description, 'sentry.png');
+      expect(span.status, SpanStatus.ok());
+      expect(span.origin, SentryTraceOrigins.autoFile);
+      expect(span.data['file.size'], 3535);
+      expect(span.data['file.chunk_count'], chunks.length);
+      expect(span.data['file.async'], true);
+      expect(span.data['file.time_to_first_byte_ms'], isNotNull);
+      expect(
+          (span.data['file.path'] as String)
+              .endsWith('test_resources/sentry.png'),
+          true);
+
+      final breadcrumb = call.scope?.breadcrumbs.single;
+      expect(breadcrumb?.category, 'file.read');
+      expect(breadcrumb?.data?['file.size'], 3535);
+    });
+
+    test('openRead passes chunks through unchanged', () async {
+      final file = File('test_resources/sentry.png');
+
+      final sut = fixture.getSut(file, tracesSampleRate: 1.0);
+
+      final chunks = await sut.openRead(10, 100).toList();
+
+      expect(
+        chunks.expand((chunk) => chunk).toList(),
+        (await file.readAsBytes()).sublist(10, 100),
+      );
+    });
+
+    test('openRead marks cancelled streams', () async {
+      final file = File('test_resources/sentry.png');
+
+      final sut = fixture.getSut(file, tracesSampleRate: 1.0);
+
+      final tr = fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+      final subscription = sut.openRead().listen(null);
+      await subscription.cancel();
+
+      await tr.finish();
+
+      final call = fixture.client.captureTransactionCalls.first;
+      final span = call.transaction.spans.single;
+      expect(span.status, SpanStatus.cancelled());
+    });
+
+    test('openRead adds error span', () async {
+      final file = File('test_resources/does_not_exist.txt');
+
+      final sut = fixture.getSut(file, tracesSampleRate: 1.0);
+
+      final tr = fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+      await expectLater(
+        sut.openRead().toList(),
+        throwsA(isA<FileSystemException>()),
+      );
+
+      await tr.finish();
+
+      final call = fixture.client.captureTransactionCalls.first;
+      final span = call.transaction.spans.single;
+      expect(span.status, SpanStatus.internalError());
+      expect(span.throwable, isA<FileSystemException>());
+    });
+
+    test('openWrite adds one span when the sink is closed', () async {
+      final directory = await Directory.systemTemp.createTemp('sentry_file');
+      final file = File('${directory.path}/stream.txt');
+
+      final sut = fixture.getSut(file, tracesSampleRate: 1.0);
+
+      final tr = fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+      final sink = sut.openWrite();
+      sink.write('Hello');
+      sink.add([32, 87, 111, 114, 108, 100]);
+      await sink.close();
+
+      await tr.finish();
+
+      expect(await file.readAsString(), 'Hello World');
+
+      final call = fixture.client.captureTransactionCalls.first;
+      final span = call.transaction.spans.single;
+      expect(span.context.operation, 'file.write');
+      expect(span.context.description, 'stream.txt');
+      expect(span.status, SpanStatus.ok());
+      expect(span.data['file.size'], 11);
+      expect(span.data['file.chunk_count'], greaterThan(0));
+      expect(span.data.containsKey('file.path'), false);
+
+      await directory.delete(recursive: true);
+    });
+  });
+
   group('$SentryOptions config', () {
     late Fixture fixture;
 
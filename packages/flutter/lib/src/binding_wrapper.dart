@@ -151,3 +151,21 @@ mixin SentryWidgetsBindingMixin on WidgetsBinding {
     }
   }
 }
+
+/// Number of frames [binding] has rendered since the first call for it.
+///
+/// Persistent frame callbacks can't be removed, so there is one callback per
+/// binding, shared by all callers, which only holds on to the counter.
+@internal
+int renderedFrameCount(WidgetsBinding binding) =>
+    (_frameCounters[binding] ??= _FrameCounter(binding)).count;
+
+final _frameCounters = Expando<_FrameCounter>();
+
+class _FrameCounter {
+  _FrameCounter(WidgetsBinding binding) {
+    binding.addPersistentFrameCallback((_) => count++);
+  }
+
+  int count = 0;
+}
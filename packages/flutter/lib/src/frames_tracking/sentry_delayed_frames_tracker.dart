@@ -28,18 +28,26 @@ const _frozenFrameThreshold = Duration(milliseconds: 700);
 /// aimed to replicate the build duration that you would receive from [addTimingsCallback].
 @internal
 class SentryDelayedFramesTracker {
-  SentryDelayedFramesTracker(this._options, this._expectedFrameDuration);
+  SentryDelayedFramesTracker(this._options, Duration expectedFrameDuration)
+      : _expectedFrameDurationMs = expectedFrameDuration.inMilliseconds;
 
-  /// List of frame timings that holds delayed frames (slow and frozen frames).
+  /// Delayed frames (slow and frozen frames) in a time-ordered ring buffer.
   /// We don't keep track of normal frames since we can estimate the number of
   /// normal frames based on the span duration and the expected frame duration.
-  /// Since startFrame and endFrame is always called sequentially by Flutter we
-  /// don't need a SplayTree
-  final List<SentryFrameTiming> _delayedFrames = [];
+  /// Since startFrame and endFrame is always called sequentially by Flutter,
+  /// frames are ordered by both start and end time, which allows range
+  /// queries with a binary search.
+  final _DelayedFramesBuffer _delayedFrames = _DelayedFramesBuffer();
+
+  /// A copy of the tracked frames, oldest first.
   @visibleForTesting
-  List<SentryFrameTiming> get delayedFrames => _delayedFrames.toList();
+  List<SentryFrameTiming> get delayedFrames => [
+        for (var i = 0; i < _delayedFrames.length; i++)
+          _delayedFrames.frameAt(i),
+      ];
+
   final SentryFlutterOptions _options;
-  final Duration _expectedFrameDuration;
+  final int _expectedFrameDurationMs;
   DateTime? _oldestFrameEndTimestamp;
   @visibleForTesting
   DateTime? get oldestFrameEndTimestamp => _oldestFrameEndTimestamp;
@@ -50,28 +58,38 @@ class SentryDelayedFramesTracker {
     required DateTime startTimestamp,
     required DateTime endTimestamp,
   }) {
-    return _delayedFrames.where((frame) {
-      // Fully contained or exactly matching
-      final fullyContainedOrMatching =
-          frame.startTimestamp.compareTo(startTimestamp) >= 0 &&
-              frame.endTimestamp.compareTo(endTimestamp) <= 0;
-
-      // Partially contained, starts before range, ends within range
-      final startsBeforeEndsWithin =
-          frame.startTimestamp.isBefore(startTimestamp) &&
-              frame.endTimestamp.isAfter(startTimestamp) &&
-              frame.endTimestamp.isBefore(endTimestamp);
-
-      // Partially contained, starts within range, ends after range
-      final startsWithinEndsAfter =
-          frame.startTimestamp.isAfter(startTimestamp) &&
-              frame.startTimestamp.isBefore(endTimestamp) &&
-              frame.endTimestamp.isAfter(endTimestamp);
-
-      return fullyContainedOrMatching ||
-          startsBeforeEndsWithin ||
-          startsWithinEndsAfter;
-    }).toList(growable: false);
+    final startUs = startTimestamp.microsecondsSinceEpoch;
+    final endUs = endTimestamp.microsecondsSinceEpoch;
+    final frames = _delayedFrames;
+    final from = frames.firstWhereEndUs((frameEndUs) => frameEndUs >= startUs);
+    final to = frames.firstWhereStartUs(
+      (frameStartUs) => frameStartUs > endUs,
+      from: from,
+    );
+    return [
+      for (var i = from; i < to; i++)
+        if (_intersects(frames.startUsAt(i), frames.endUsAt(i), startUs, endUs))
+          frames.frameAt(i),
+    ];
+  }
+
+  static bool _intersects(
+      int frameStartUs, int frameEndUs, int startUs, int endUs) {
+    // Fully contained or exactly matching
+    final fullyContainedOrMatching =
+        frameStartUs >= startUs && frameEndUs <= endUs;
+
+    // Partially contained, starts before range, ends within range
+    final startsBeforeEndsWithin =
+        frameStartUs < startUs && frameEndUs > startUs && frameEndUs < endUs;
+
+    // Partially contained, starts within range, ends after range
+    final startsWithinEndsAfter =
+        frameStartUs > startUs && frameStartUs < endUs && frameEndUs > endUs;
+
+    return fullyContainedOrMatching ||
+        startsBeforeEndsWithin ||
+        startsWithinEndsAfter;
   }
 
   /// Records the start and end time of a delayed frame.
@@ -93,11 +111,18 @@ class SentryDelayedFramesTracker {
       );
       return;
     }
-    final frameTiming = SentryFrameTiming(
-      startTimestamp: startTimestamp,
-      endTimestamp: endTimestamp,
+    final startUs = startTimestamp.microsecondsSinceEpoch;
+    final endUs = endTimestamp.microsecondsSinceEpoch;
+    final durationMs = (endUs - startUs) ~/ Duration.microsecondsPerMillisecond;
+    final isFrozen = durationMs >= _frozenFrameThreshold.inMilliseconds;
+    final isSlow = !isFrozen && durationMs > _expectedFrameDurationMs;
+    _delayedFrames.add(
+      startUs,
+      endUs,
+      slow: isSlow,
+      frozen: isFrozen,
+      delayMs: max(0, durationMs - _expectedFrameDurationMs),
     );
-    _delayedFrames.add(frameTiming);
     _oldestFrameEndTimestamp ??= endTimestamp;
   }
 
@@ -106,63 +131,91 @@ class SentryDelayedFramesTracker {
       return;
     }
     if (_oldestFrameEndTimestamp!.isBefore(spanStartTimestamp)) {
-      _delayedFrames.removeWhere(
-        (frame) => frame.startTimestamp.isBefore(spanStartTimestamp),
-      );
-      _oldestFrameEndTimestamp = _delayedFrames.firstOrNull?.endTimestamp;
+      final spanStartUs = spanStartTimestamp.microsecondsSinceEpoch;
+      _delayedFrames.removeFirst(_delayedFrames
+          .firstWhereStartUs((frameStartUs) => frameStartUs >= spanStartUs));
+      _oldestFrameEndTimestamp = _delayedFrames.isEmpty
+          ? null
+          : DateTime.fromMicrosecondsSinceEpoch(_delayedFrames.endUsAt(0),
+              isUtc: _oldestFrameEndTimestamp!.isUtc);
     }
   }
 
   /// Calculates the frame metrics based on start, end timestamps and the
   /// delayed frames metrics. If the delayed frames array is empty then
   /// only the total frames will be calculated.
+  ///
+  /// Frames fully contained in the span are aggregated with prefix sums, so
+  /// only the frames overlapping the span boundaries are looked at one by
+  /// one. This keeps the cost at O(log n) in the number of tracked frames.
   SpanFrameMetrics? getFrameMetrics({
     required DateTime spanStartTimestamp,
     required DateTime spanEndTimestamp,
   }) {
-    final relevantFrames = getFramesIntersecting(
-      startTimestamp: spanStartTimestamp,
-      endTimestamp: spanEndTimestamp,
-    );
     final spanDuration =
         spanEndTimestamp.difference(spanStartTimestamp).inMilliseconds;
+    final expectedDurationMs = _expectedFrameDurationMs;
+
+    final spanStartUs = spanStartTimestamp.microsecondsSinceEpoch;
+    final spanEndUs = spanEndTimestamp.microsecondsSinceEpoch;
+    final spanStartMs = spanStartTimestamp.millisecondsSinceEpoch;
+    final spanEndMs = spanEndTimestamp.millisecondsSinceEpoch;
+
+    final frames = _delayedFrames;
+    // Frames ending before the span starts or starting after it ends don't
+    // contribute to the span.
+    final from = frames.firstWhereEndUs(
+      (frameEndUs) => _toMs(frameEndUs) > spanStartMs,
+    );
+    final to = frames.firstWhereStartUs(
+      (frameStartUs) => _toMs(frameStartUs) >= spanEndMs,
+      from: from,
+    );
+    // Frames in [containedFrom, containedTo) are fully contained in the span.
+    final containedFrom = frames.firstWhereStartUs(
+      (frameStartUs) => frameStartUs >= spanStartUs,
+      from: from,
+      to: to,
+    );
+    final containedTo = max(
+      containedFrom,
+      frames.firstWhereEndUs(
+        (frameEndUs) => frameEndUs > spanEndUs,
+        from: from,
+        to: to,
+      ),
+    );
 
     // No slow or frozen frames detected
-    if (relevantFrames.isEmpty) {
+    if (from == to) {
       return SpanFrameMetrics(
-        totalFrameCount:
-            (spanDuration / _expectedFrameDuration.inMilliseconds).ceil(),
+        totalFrameCount: (spanDuration / expectedDurationMs).ceil(),
         slowFrameCount: 0,
         frozenFrameCount: 0,
         framesDelay: 0.0,
       );
     }
 
-    final spanStartMs = spanStartTimestamp.millisecondsSinceEpoch;
-    final spanEndMs = spanEndTimestamp.millisecondsSinceEpoch;
-    final expectedDurationMs = _expectedFrameDuration.inMilliseconds;
     final frozenThresholdMs = _frozenFrameThreshold.inMilliseconds;
 
-    int slowFrameCount = 0;
-    int frozenFrameCount = 0;
-    int slowFramesDuration = 0;
-    int frozenFramesDuration = 0;
-    int framesDelayMs = 0;
-
-    for (final timing in relevantFrames) {
-      final frameStartMs = timing.startTimestamp.millisecondsSinceEpoch;
-      final frameEndMs = timing.endTimestamp.millisecondsSinceEpoch;
-      final frameDurationMs = timing.duration.inMilliseconds;
-
-      if (frameEndMs <= spanStartMs) {
-        // Frame ends before the span starts, skip it
-        continue;
+    final contained = frames.sum(containedFrom, containedTo);
+    int slowFrameCount = contained.slowCount;
+    int frozenFrameCount = contained.frozenCount;
+    int slowFramesDuration = contained.slowDurationMs;
+    int frozenFramesDuration = contained.frozenDurationMs;
+    int framesDelayMs = contained.delayMs;
+
+    void addPartialFrame(int index) {
+      final frameStartUs = frames.startUsAt(index);
+      final frameEndUs = frames.endUsAt(index);
+      if (!_intersects(frameStartUs, frameEndUs, spanStartUs, spanEndUs)) {
+        return;
       }
 
-      if (frameStartMs >= spanEndMs) {
-        // Frames are ordered, every next frame will start after this span, stop processing
-        break;
-      }
+      final frameStartMs = _toMs(frameStartUs);
+      final frameEndMs = _toMs(frameEndUs);
+      final frameDurationMs =
+          (frameEndUs - frameStartUs) ~/ Duration.microsecondsPerMillisecond;
 
       // Calculate effective duration and delay
       int effectiveDuration;
@@ -197,9 +250,18 @@ class SentryDelayedFramesTracker {
       framesDelayMs += effectiveDelay;
     }
 
+    // Frames overlapping the span start or end. Flutter renders frames
+    // sequentially, so there is at most one at each boundary.
+    for (var i = from; i < containedFrom; i++) {
+      addPartialFrame(i);
+    }
+    for (var i = containedTo; i < to; i++) {
+      addPartialFrame(i);
+    }
+
     final normalFramesCount =
         (spanDuration - (slowFramesDuration + frozenFramesDuration)) /
-            _expectedFrameDuration.inMilliseconds;
+            expectedDurationMs;
     final totalFrameCount =
         (normalFramesCount + slowFrameCount + frozenFrameCount).ceil();
 
@@ -230,6 +292,196 @@ class SentryDelayedFramesTracker {
   }
 }
 
+int _toMs(int microseconds) =>
+    microseconds ~/ Duration.microsecondsPerMillisecond;
+
+/// Aggregated values of a range of frames in [_DelayedFramesBuffer].
+typedef _FrameSums = ({
+  int slowCount,
+  int frozenCount,
+  int slowDurationMs,
+  int frozenDurationMs,
+  int delayMs,
+});
+
+/// Time-ordered ring buffer of delayed frames.
+///
+/// Besides the frame timestamps, each slot stores the running totals of all
+/// frames added before it (prefix sums), so aggregates over any range of
+/// frames are a subtraction of two slots. Removing frames from the front
+/// only moves the head and keeps the running totals valid.
+class _DelayedFramesBuffer {
+  static const _initialCapacity = 64;
+
+  int _capacity = 0;
+  int _head = 0;
+  int _length = 0;
+
+  List<int> _startUs = const [];
+  List<int> _endUs = const [];
+
+  // Running totals of all frames added before the frame in the same slot.
+  List<int> _slowCountBefore = const [];
+  List<int> _frozenCountBefore = const [];
+  List<int> _slowDurationBefore = const [];
+  List<int> _frozenDurationBefore = const [];
+  List<int> _delayBefore = const [];
+
+  // Running totals of all frames added so far.
+  int _slowCountTotal = 0;
+  int _frozenCountTotal = 0;
+  int _slowDurationTotal = 0;
+  int _frozenDurationTotal = 0;
+  int _delayTotal = 0;
+
+  int get length => _length;
+
+  bool get isEmpty => _length == 0;
+
+  int _slot(int index) => (_head + index) & (_capacity - 1);
+
+  int startUsAt(int index) => _startUs[_slot(index)];
+
+  int endUsAt(int index) => _endUs[_slot(index)];
+
+  SentryFrameTiming frameAt(int index) {
+    final slot = _slot(index);
+    return SentryFrameTiming(
+      startTimestamp: DateTime.fromMicrosecondsSinceEpoch(_startUs[slot]),
+      endTimestamp: DateTime.fromMicrosecondsSinceEpoch(_endUs[slot]),
+    );
+  }
+
+  void add(
+    int startUs,
+    int endUs, {
+    required bool slow,
+    required bool frozen,
+    required int delayMs,
+  }) {
+    if (_length == _capacity) {
+      _grow();
+    }
+    final slot = _slot(_length);
+    _startUs[slot] = startUs;
+    _endUs[slot] = endUs;
+    _slowCountBefore[slot] = _slowCountTotal;
+    _frozenCountBefore[slot] = _frozenCountTotal;
+    _slowDurationBefore[slot] = _slowDurationTotal;
+    _frozenDurationBefore[slot] = _frozenDurationTotal;
+    _delayBefore[slot] = _delayTotal;
+    _length++;
+
+    final durationMs = _toMs(endUs - startUs);
+    if (frozen) {
+      _frozenCountTotal++;
+      _frozenDurationTotal += durationMs;
+    } else if (slow) {
+      _slowCountTotal++;
+      _slowDurationTotal += durationMs;
+    }
+    _delayTotal += delayMs;
+  }
+
+  /// Removes the first [count] frames.
+  void removeFirst(int count) {
+    if (count >= _length) {
+      clear();
+      return;
+    }
+    _head = _slot(count);
+    _length -= count;
+  }
+
+  void clear() {
+    _head = 0;
+    _length = 0;
+    _slowCountTotal = 0;
+    _frozenCountTotal = 0;
+    _slowDurationTotal = 0;
+    _frozenDurationTotal = 0;
+    _delayTotal = 0;
+  }
+
+  /// Aggregates of the frames in [from, to).
+  _FrameSums sum(int from, int to) {
+    if (from >= to) {
+      return (
+        slowCount: 0,
+        frozenCount: 0,
+        slowDurationMs: 0,
+        frozenDurationMs: 0,
+        delayMs: 0,
+      );
+    }
+    final first = _slot(from);
+    if (to == _length) {
+      return (
+        slowCount: _slowCountTotal - _slowCountBefore[first],
+        frozenCount: _frozenCountTotal - _frozenCountBefore[first],
+        slowDurationMs: _slowDurationTotal - _slowDurationBefore[first],
+        frozenDurationMs: _frozenDurationTotal - _frozenDurationBefore[first],
+        delayMs: _delayTotal - _delayBefore[first],
+      );
+    }
+    final end = _slot(to);
+    return (
+      slowCount: _slowCountBefore[end] - _slowCountBefore[first],
+      frozenCount: _frozenCountBefore[end] - _frozenCountBefore[first],
+      slowDurationMs: _slowDurationBefore[end] - _slowDurationBefore[first],
+      frozenDurationMs:
+          _frozenDurationBefore[end] - _frozenDurationBefore[first],
+      delayMs: _delayBefore[end] - _delayBefore[first],
+    );
+  }
+
+  /// Index of the first frame in [from, to) whose start time satisfies
+  /// [test], or [to] if there is none. [test] must be monotonic over the
+  /// frames, i.e. false for a prefix and true for the rest.
+  int firstWhereStartUs(bool Function(int startUs) test,
+          {int from = 0, int? to}) =>
+      _lowerBound(_startUs, test, from, to ?? _length);
+
+  /// Like [firstWhereStartUs], but tests the end time of the frames.
+  int firstWhereEndUs(bool Function(int endUs) test, {int from = 0, int? to}) =>
+      _lowerBound(_endUs, test, from, to ?? _length);
+
+  int _lowerBound(List<int> values, bool Function(int) test, int from, int to) {
+    var low = from;
+    var high = to;
+    while (low < high) {
+      final mid = (low + high) >> 1;
+      if (test(values[_slot(mid)])) {
+        high = mid;
+      } else {
+        low = mid + 1;
+      }
+    }
+    return low;
+  }
+
+  void _grow() {
+    final capacity = _capacity == 0 ? _initialCapacity : _capacity * 2;
+    List<int> copy(List<int> values) {
+      final result = List<int>.filled(capacity, 0);
+      for (var i = 0; i < _length; i++) {
+        result[i] = values[_slot(i)];
+      }
+      return result;
+    }
+
+    _startUs = copy(_startUs);
+    _endUs = copy(_endUs);
+    _slowCountBefore = copy(_slowCountBefore);
+    _frozenCountBefore = copy(_frozenCountBefore);
+    _slowDurationBefore = copy(_slowDurationBefore);
+    _frozenDurationBefore = copy(_frozenDurationBefore);
+    _delayBefore = copy(_delayBefore);
+    _capacity = capacity;
+    _head = 0;
+  }
+}
+
 /// Frame timing that represents an approximation of the frame's build duration.
 @internal
 class SentryFrameTiming {
@@ -6,6 +6,7 @@ import 'package:meta/meta.dart';
 
 import '../../../sentry_flutter.dart';
 import '../../isolate/isolate_worker.dart';
+import '../../replay/replay_frame_deduplicator.dart';
 import '../../replay/scheduled_recorder.dart';
 import '../../screenshot/screenshot.dart';
 import '../../utils/internal_logger.dart';
@@ -116,6 +117,7 @@ class _AndroidReplayHandler extends WorkerHandler {
   // Android Bitmap creation is a bit costly so we reuse it between captures.
   native.Bitmap? _bitmap;
   native.ReplayIntegration? _nativeReplay;
+  final _deduplicator = ReplayFrameDeduplicator();
 
   _AndroidReplayHandler(this._config);
 
@@ -141,6 +143,14 @@ class _AndroidReplayHandler extends WorkerHandler {
     }
 
     final item = payload;
+    final data = item.data.materialize().asUint8List();
+    // Compared here rather than on the main isolate, which only pays for
+    // handing the bytes over.
+    if (!_deduplicator.shouldSubmit(
+        data, item.width, item.height, item.timestamp)) {
+      return null;
+    }
+
     JByteBuffer? jBuffer;
     native.Bitmap$Config? bitmapConfig;
 
@@ -171,13 +181,17 @@ class _AndroidReplayHandler extends WorkerHandler {
         bitmap = newBitmap;
       }
 
-      jBuffer = JByteBuffer.fromList(item.data.materialize().asUint8List());
+      jBuffer = JByteBuffer.fromList(data);
       bitmap.copyPixelsFromBuffer(jBuffer);
 
       // TODO timestamp is currently missing in onScreenshotRecorded()
       _nativeReplay ??=
           native.SentryFlutterPlugin.privateSentryGetReplayIntegration();
-      _nativeReplay?.onScreenshotRecorded(bitmap);
+      final nativeReplay = _nativeReplay;
+      if (nativeReplay != null) {
+        nativeReplay.onScreenshotRecorded(bitmap);
+        _deduplicator.submitted(data, item.width, item.height, item.timestamp);
+      }
 
       return null;
     } catch (exception, stackTrace) {
@@ -197,6 +211,7 @@ class _AndroidReplayHandler extends WorkerHandler {
   }
 
   void _releaseNativeRefs() {
+    _deduplicator.reset();
     _releaseBitmap();
     _nativeReplay?.release();
     _nativeReplay = null;
@@ -12,23 +12,20 @@ class NativeMemory {
 
   const NativeMemory._(this.pointer, this.length);
 
+  /// Copies [source] into newly allocated native memory.
+  ///
+  /// The memory is passed to native code, which takes ownership and frees
+  /// it, so it can't be pooled and reused on the Dart side.
   factory NativeMemory.fromByteData(ByteData source) {
     final lengthInBytes = source.lengthInBytes;
     final ptr = pkg_ffi.malloc.allocate<Uint8>(lengthInBytes);
-
-    // TODO memcpy() from source.buffer.asUint8List().address
-    //      once we can depend on Dart SDK 3.5+
-    final numWords = lengthInBytes ~/ 8;
-    final words = ptr.cast<Uint64>().asTypedList(numWords);
-    if (numWords > 0) {
-      words.setAll(0, source.buffer.asUint64List(0, numWords));
-    }
-
-    final bytes = ptr.asTypedList(lengthInBytes);
-    for (var i = words.lengthInBytes; i < source.lengthInBytes; i++) {
-      bytes[i] = source.getUint8(i);
+    if (lengthInBytes > 0) {
+      _memcpy(
+        ptr,
+        source.buffer.asUint8List(source.offsetInBytes, lengthInBytes).address,
+        lengthInBytes,
+      );
     }
-
     return NativeMemory._(ptr, lengthInBytes);
   }
 
@@ -58,3 +55,27 @@ class NativeMemory {
 extension ByteDataNativeMemory on ByteData {
   NativeMemory toNativeMemory() => NativeMemory.fromByteData(this);
 }
+
+/// A leaf call doesn't leave the Dart thread state, so copying a screenshot
+/// is a single native memcpy on the typed data's memory.
+@Native<Pointer<Void> Function(Pointer<Uint8>, Pointer<Uint8>, Size)>(
+    symbol: 'memcpy', isLeaf: true)
+external Pointer<Void> _memcpy(Pointer<Uint8> dest, Pointer<Uint8> src, int n);
+
+/// Whether [a] and [b] hold the same bytes, compared by a single leaf
+/// memcmp on the memory of the views.
+@internal
+bool bytesEqual(Uint8List a, Uint8List b) {
+  if (identical(a, b)) {
+    return true;
+  }
+  final length = a.lengthInBytes;
+  if (length != b.lengthInBytes) {
+    return false;
+  }
+  return length == 0 || _memcmp(a.address, b.address, length) == 0;
+}
+
+@Native<Int Function(Pointer<Uint8>, Pointer<Uint8>, Size)>(
+    symbol: 'memcmp', isLeaf: true)
+external int _memcmp(Pointer<Uint8> a, Pointer<Uint8> b, int n);
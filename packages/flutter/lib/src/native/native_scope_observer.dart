@@ -16,7 +16,7 @@ class NativeScopeObserver implements ScopeObserver {
     if (Contexts.defaultFields.contains(key)) {
       try {
         final json = (value as dynamic).toJson();
-        return _native.setContexts(key, json);
+        return _measure(() => _native.setContexts(key, json));
       } catch (_) {
         _options.log(
           SentryLevel.error,
@@ -24,47 +24,54 @@ class NativeScopeObserver implements ScopeObserver {
         );
       }
     } else {
-      return _native.setContexts(key, value);
+      return _measure(() => _native.setContexts(key, value));
     }
   }
 
   @override
   FutureOr<void> removeContexts(String key) {
-    return _native.removeContexts(key);
+    return _measure(() => _native.removeContexts(key));
   }
 
   @override
   FutureOr<void> setUser(SentryUser? user) {
-    return _native.setUser(user);
+    return _measure(() => _native.setUser(user));
   }
 
   @override
   FutureOr<void> addBreadcrumb(Breadcrumb breadcrumb) {
-    return _native.addBreadcrumb(breadcrumb);
+    return _measure(() => _native.addBreadcrumb(breadcrumb));
   }
 
   @override
   FutureOr<void> clearBreadcrumbs() {
-    return _native.clearBreadcrumbs();
+    return _measure(() => _native.clearBreadcrumbs());
   }
 
   @override
   Future<void> setExtra(String key, dynamic value) async {
-    await _native.setExtra(key, value);
+    await _measure(() => _native.setExtra(key, value));
   }
 
   @override
   Future<void> removeExtra(String key) async {
-    await _native.removeExtra(key);
+    await _measure(() => _native.removeExtra(key));
   }
 
   @override
   Future<void> setTag(String key, String value) async {
-    await _native.setTag(key, value);
+    await _measure(() => _native.setTag(key, value));
   }
 
   @override
   Future<void> removeTag(String key) async {
-    await _native.removeTag(key);
+    await _measure(() => _native.removeTag(key));
   }
+
+  /// Records the time spent on this isolate to sync a scope change. Only
+  /// the synchronous part of [call] is measured, not the wait for async
+  /// native calls to complete.
+  FutureOr<void> _measure(FutureOr<void> Function() call) =>
+      // ignore: invalid_use_of_internal_member
+      _options.sdkOverheadStats.measure(SdkOverheadStage.scopeSync, call);
 }
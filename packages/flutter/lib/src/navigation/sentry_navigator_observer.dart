@@ -171,6 +171,7 @@ class SentryNavigatorObserver extends RouteObserver<PageRoute<dynamic>> {
       from: previousRoute?.settings,
       to: route.settings,
     );
+    _dispatchOnNavigation(from: previousRoute, to: route);
 
     _addWebSessions(from: previousRoute, to: route);
 
@@ -207,6 +208,7 @@ class SentryNavigatorObserver extends RouteObserver<PageRoute<dynamic>> {
       from: oldRoute?.settings,
       to: newRoute?.settings,
     );
+    _dispatchOnNavigation(from: oldRoute, to: newRoute);
 
     _addWebSessions(from: oldRoute, to: newRoute);
   }
@@ -229,6 +231,7 @@ class SentryNavigatorObserver extends RouteObserver<PageRoute<dynamic>> {
       from: route.settings,
       to: previousRoute?.settings,
     );
+    _dispatchOnNavigation(from: route, to: previousRoute);
 
     _addWebSessions(from: route, to: previousRoute);
 
@@ -298,6 +301,15 @@ class SentryNavigatorObserver extends RouteObserver<PageRoute<dynamic>> {
     await _webSessionHandler?.startSession(from: fromName, to: toName);
   }
 
+  /// Lets integrations react to navigation, e.g. an adaptive replay capture
+  /// returns to its full frame rate.
+  void _dispatchOnNavigation({Route<dynamic>? from, Route<dynamic>? to}) {
+    _hub.options.lifecycleRegistry.dispatchCallback(OnNavigation(
+      from: from != null ? _getRouteName(from) : null,
+      to: to != null ? _getRouteName(to) : null,
+    ));
+  }
+
   void _addBreadcrumb({
     required String type,
     RouteSettings? from,
@@ -1,3 +1,5 @@
+// ignore_for_file: invalid_use_of_internal_member
+
 import 'dart:async';
 
 import 'package:meta/meta.dart';
@@ -18,6 +20,11 @@ class ReplayIntegration extends Integration<SentryFlutterOptions> {
 
   Hub? _hub;
   SentryFlutterOptions? _options;
+  SentryScreenshotWidgetStatus? _status;
+
+  /// Whether replays are recorded in [SentryReplayQuality.low] because of
+  /// memory pressure.
+  var _lowQuality = false;
 
   @override
   FutureOr<void> call(Hub hub, SentryFlutterOptions options) {
@@ -32,6 +39,9 @@ class ReplayIntegration extends Integration<SentryFlutterOptions> {
         options.addEventProcessor(ReplayEventProcessor(hub, _native));
       }
 
+      options.lifecycleRegistry
+          .registerCallback<OnMemoryPressure>(_onMemoryPressure);
+
       SentryScreenshotWidget.onBuild((status, prevStatus) {
         // Skip config update if the difference is negligible (e.g., due to floating-point precision)
         // e.g a size.height of 200.00001 and 200.001 could be treated as equals
@@ -39,19 +49,39 @@ class ReplayIntegration extends Integration<SentryFlutterOptions> {
           return true;
         }
 
-        _native.setReplayConfig(ReplayConfig(
-            windowWidth: status.size?.width ?? 0.0,
-            windowHeight: status.size?.height ?? 0.0,
-            width: replayOptions.quality.resolutionScalingFactor *
-                (status.size?.width ?? 0.0),
-            height: replayOptions.quality.resolutionScalingFactor *
-                (status.size?.height ?? 0.0)));
-
+        _status = status;
+        _setReplayConfig(status);
         return true;
       });
     }
   }
 
+  void _setReplayConfig(SentryScreenshotWidgetStatus status) {
+    final quality =
+        _lowQuality ? SentryReplayQuality.low : _options!.replay.quality;
+    _native.setReplayConfig(ReplayConfig(
+        windowWidth: status.size?.width ?? 0.0,
+        windowHeight: status.size?.height ?? 0.0,
+        width: quality.resolutionScalingFactor * (status.size?.width ?? 0.0),
+        height:
+            quality.resolutionScalingFactor * (status.size?.height ?? 0.0)));
+  }
+
+  /// Records in a lower resolution while the memory pressure is at least
+  /// [MemoryPressureLevel.high].
+  void _onMemoryPressure(OnMemoryPressure event) {
+    final lowQuality = event.level.isAtLeast(MemoryPressureLevel.high);
+    if (lowQuality == _lowQuality) {
+      return;
+    }
+    _lowQuality = lowQuality;
+    final status = _status;
+    if (status != null &&
+        _options?.replay.quality != SentryReplayQuality.low) {
+      _setReplayConfig(status);
+    }
+  }
+
   Future<void> captureReplay() async {
     if (_native.supportsReplay && _options?.replay.isEnabled == true) {
       final replayId = await _native.captureReplay();
@@ -1,4 +1,5 @@
 // ignore_for_file: invalid_use_of_internal_member
+import 'dart:async';
 import 'dart:convert';
 import 'dart:typed_data';
 
@@ -60,7 +61,8 @@ class FlutterNetworkDetailsCapture implements NetworkDetailsCapture {
   }
 
   @override
-  Future<(StreamedResponse, Map<String, dynamic>)> captureResponse(
+  Future<(StreamedResponse, Map<String, dynamic>, Future<void>?)>
+      captureResponse(
     StreamedResponse response,
   ) async {
     final data = <String, dynamic>{
@@ -68,39 +70,86 @@ class FlutterNetworkDetailsCapture implements NetworkDetailsCapture {
           response.headers, _options.replay.networkResponseHeaders),
     };
 
+    final contentType = response.headers['content-type'];
     final contentLength = response.contentLength;
     if (!_options.sendDefaultPii ||
         !_options.replay.networkCaptureBodies ||
-        !_isCapturableContentType(response.headers['content-type']) ||
+        !_isCapturableContentType(contentType) ||
         (contentLength != null && contentLength > maxBodySize)) {
-      return (response, data);
+      return (response, data, null);
     }
 
-    Uint8List bytes;
-    try {
-      bytes = await response.stream.toBytes();
-    } catch (exception) {
-      internalLogger.warning(
-        () => 'Failed to capture response body for replay: $exception',
-      );
-      // The stream is partially consumed at this point, so it can't be
-      // forwarded to the original caller anymore. Rethrow the real failure
-      // instead of returning a response whose stream would throw a
-      // confusing "already listened to" error when read again downstream.
-      rethrow;
+    // The body is copied while the caller reads it instead of being read
+    // up front, so the caller gets every chunk as soon as it arrives and
+    // the response is never held in memory as a whole for capturing.
+    final body = _CapturedBody(contentLength);
+    final captured = Completer<void>.sync();
+    var failed = false;
+    void finish({required bool complete}) {
+      if (captured.isCompleted) {
+        return;
+      }
+      if (!failed) {
+        data['body'] = body.decode();
+        if (body.truncated || !complete) {
+          data['_meta'] = {
+            'warnings': [
+              _isJson(contentType) ? 'MAYBE_JSON_TRUNCATED' : 'TEXT_TRUNCATED',
+            ],
+          };
+        }
+      }
+      captured.complete();
     }
 
-    // The body is already fully read at this point, so decoding failures
-    // (e.g. malformed encoding info) shouldn't prevent forwarding it as-is.
-    final forwarded = _copyWithBytes(response, bytes);
-    try {
-      data['body'] = _truncateBytes(bytes);
-    } catch (exception) {
-      internalLogger.warning(
-        () => 'Failed to capture response body for replay: $exception',
-      );
-    }
-    return (forwarded, data);
+    // The body is only captured if the caller starts reading it right away,
+    // e.g. through `Response.fromStream`, so that the breadcrumb isn't held
+    // back by a response that is read much later or never.
+    final notListened = Timer(Duration.zero, () {
+      if (!captured.isCompleted) {
+        captured.complete();
+      }
+    });
+
+    late StreamSubscription<List<int>> subscription;
+    // Synchronous, so chunks are passed on as they arrive, without another
+    // microtask per chunk.
+    final controller = StreamController<List<int>>(sync: true);
+    controller
+      ..onListen = () {
+        notListened.cancel();
+        subscription = response.stream.listen(
+          (chunk) {
+            body.add(chunk);
+            controller.add(chunk);
+          },
+          onError: (Object exception, StackTrace stackTrace) {
+            // A partially read body isn't worth showing, the error still
+            // reaches the caller unchanged.
+            failed = true;
+            internalLogger.warning(
+              () => 'Failed to capture response body for replay: $exception',
+            );
+            controller.addError(exception, stackTrace);
+          },
+          onDone: () {
+            finish(complete: true);
+            controller.close();
+          },
+        );
+      }
+      ..onPause = () => subscription.pause()
+      ..onResume = () => subscription.resume()
+      ..onCancel = () {
+        finish(complete: false);
+        return subscription.cancel();
+      };
+
+    return (
+      _copyWithStream(response, controller.stream),
+      data,
+      captured.future,
+    );
   }
 
   String? _captureRequestBody(BaseRequest request) {
@@ -131,9 +180,12 @@ class FlutterNetworkDetailsCapture implements NetworkDetailsCapture {
     }
   }
 
-  StreamedResponse _copyWithBytes(StreamedResponse response, List<int> bytes) {
+  StreamedResponse _copyWithStream(
+    StreamedResponse response,
+    Stream<List<int>> stream,
+  ) {
     return StreamedResponse(
-      Stream.value(bytes),
+      stream,
       response.statusCode,
       contentLength: response.contentLength,
       request: response.request,
@@ -173,6 +225,9 @@ class FlutterNetworkDetailsCapture implements NetworkDetailsCapture {
         normalized.contains('x-www-form-urlencoded');
   }
 
+  bool _isJson(String? contentType) =>
+      contentType != null && contentType.toLowerCase().contains('json');
+
   String _truncateBytes(Uint8List bytes) {
     final view = bytes.length <= maxBodySize
         ? bytes
@@ -180,3 +235,57 @@ class FlutterNetworkDetailsCapture implements NetworkDetailsCapture {
     return utf8.decode(view, allowMalformed: true);
   }
 }
+
+/// The first [FlutterNetworkDetailsCapture.maxBodySize] bytes of a response
+/// body.
+class _CapturedBody {
+  _CapturedBody(int? contentLength)
+      : _buffer = Uint8List(contentLength ?? _initialCapacity);
+
+  static const _initialCapacity = 16 * 1024;
+
+  Uint8List _buffer;
+  int _length = 0;
+
+  /// Whether the body had more bytes than were captured.
+  bool truncated = false;
+
+  void add(List<int> chunk) {
+    if (truncated) {
+      return;
+    }
+    final room = FlutterNetworkDetailsCapture.maxBodySize - _length;
+    final count = chunk.length <= room ? chunk.length : room;
+    final length = _length + count;
+    if (length > _buffer.length) {
+      var capacity = _buffer.length < _initialCapacity
+          ? _initialCapacity
+          : _buffer.length * 2;
+      while (capacity < length) {
+        capacity *= 2;
+      }
+      if (capacity > FlutterNetworkDetailsCapture.maxBodySize) {
+        capacity = FlutterNetworkDetailsCapture.maxBodySize;
+      }
+      _buffer = Uint8List(capacity)..setRange(0, _length, _buffer);
+    }
+    _buffer.setRange(_length, length, chunk);
+    _length = length;
+    truncated = count < chunk.length;
+  }
+
+  /// The captured bytes as text.
+  String decode() {
+    try {
+      return utf8.decode(
+        Uint8List.sublistView(_buffer, 0, _length),
+        allowMalformed: true,
+      );
+    } catch (exception) {
+      internalLogger.warning(
+        () => 'Failed to capture response body for replay: $exception',
+      );
+      return '';
+    }
+  }
+}
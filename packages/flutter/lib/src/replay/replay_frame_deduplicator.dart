@@ -0,0 +1,54 @@
+import 'dart:typed_data';
+
+import 'package:meta/meta.dart';
+
+import '../native/native_memory.dart';
+
+/// Decides which replay frames are handed over to the native SDK.
+///
+/// The native SDKs compress every frame they receive and fill the gaps in
+/// the video with the most recent frame. A frame that is identical to the
+/// previously submitted one therefore only costs a copy into a native bitmap
+/// and another compression. Such frames are skipped, except that a frame is
+/// submitted at least every [maxSkippedDuration] so that every replay
+/// segment still receives frames.
+@internal
+class ReplayFrameDeduplicator {
+  final Duration maxSkippedDuration;
+
+  Uint8List? _previous;
+  int _previousWidth = 0;
+  int _previousHeight = 0;
+  int? _lastSubmittedAt;
+
+  ReplayFrameDeduplicator(
+      {this.maxSkippedDuration = const Duration(seconds: 2)});
+
+  /// Returns whether the RGBA [frame] captured at [timestamp] (in
+  /// milliseconds since epoch) needs to be submitted.
+  bool shouldSubmit(Uint8List frame, int width, int height, int timestamp) {
+    final previous = _previous;
+    final lastSubmittedAt = _lastSubmittedAt;
+    return previous == null ||
+        lastSubmittedAt == null ||
+        width != _previousWidth ||
+        height != _previousHeight ||
+        timestamp - lastSubmittedAt >= maxSkippedDuration.inMilliseconds ||
+        !bytesEqual(previous, frame);
+  }
+
+  /// Records that [frame] was handed over to the native SDK. Only submitted
+  /// frames are compared with, so a frame that failed to be submitted is
+  /// not skipped the next time.
+  void submitted(Uint8List frame, int width, int height, int timestamp) {
+    _previous = frame;
+    _previousWidth = width;
+    _previousHeight = height;
+    _lastSubmittedAt = timestamp;
+  }
+
+  void reset() {
+    _previous = null;
+    _lastSubmittedAt = null;
+  }
+}
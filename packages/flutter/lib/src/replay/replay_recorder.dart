@@ -12,7 +12,8 @@ class ReplayScreenshotRecorder extends ScreenshotRecorder {
   ReplayScreenshotRecorder(super.options)
       : super(
             privacyOptions: options.privacy,
-            logName: 'ReplayRecorder #${++_instanceCounter}');
+            logName: 'ReplayRecorder #${++_instanceCounter}',
+            cacheMasks: true);
 
   @override
   @protected
@@ -1,9 +1,13 @@
+// ignore_for_file: invalid_use_of_internal_member
+
 import 'dart:async';
 
+import 'package:flutter/gestures.dart';
 import 'package:flutter/scheduler.dart';
 import 'package:meta/meta.dart';
 
 import '../../sentry_flutter.dart';
+import '../binding_wrapper.dart';
 import '../screenshot/screenshot.dart';
 import 'replay_recorder.dart';
 import 'scheduled_recorder_config.dart';
@@ -18,6 +22,18 @@ class ScheduledScreenshotRecorder extends ReplayScreenshotRecorder {
   late final ScheduledScreenshotRecorderCallback _callback;
   var _status = _Status.stopped;
   Scheduler? _scheduler;
+
+  /// Upper bound of the capture interval with an adaptive frame rate.
+  static const _maxAdaptiveInterval = Duration(seconds: 5);
+
+  /// Captures skipped in a row at most while the app misses its frame budget,
+  /// so that a continuously janky app is still recorded.
+  static const _maxSkippedCaptures = 3;
+
+  bool _isAdaptive = false;
+  int? _previousFrameHash;
+  FrameTiming? _lastFrameTiming;
+  int _skippedCaptures = 0;
   // late final _idleFrameFiller = _IdleFrameFiller(_frameDuration, _onScreenshot);
 
   @override
@@ -32,6 +48,9 @@ class ScheduledScreenshotRecorder extends ReplayScreenshotRecorder {
     }
   }
 
+  @visibleForTesting
+  Duration? get captureInterval => _scheduler?.interval;
+
   void _addPostFrameCallback(FrameCallback callback) {
     options.bindingUtils.instance!
       ..ensureVisualUpdate()
@@ -52,6 +71,14 @@ class ScheduledScreenshotRecorder extends ReplayScreenshotRecorder {
 
     options.log(SentryLevel.debug, "$logName: starting capture");
     _status = _Status.running;
+    options.lifecycleRegistry
+      ..removeCallback<OnMemoryPressure>(_onMemoryPressure)
+      ..registerCallback<OnMemoryPressure>(_onMemoryPressure)
+      ..removeCallback<OnNavigation>(_onNavigation);
+    if (options.replay.adaptiveFrameRate) {
+      options.lifecycleRegistry.registerCallback<OnNavigation>(_onNavigation);
+      _startAdaptiveFrameRate();
+    }
     await _restartScheduler();
   }
 
@@ -81,8 +108,9 @@ class ScheduledScreenshotRecorder extends ReplayScreenshotRecorder {
 
     _scheduler = Scheduler(
       frameDuration,
-      (_) => capture(_onImageCaptured),
+      _capture,
       _addPostFrameCallback,
+      maxInterval: _isAdaptive ? _maxAdaptiveInterval : null,
     );
 
     if (_status == _Status.running) {
@@ -99,6 +127,10 @@ class ScheduledScreenshotRecorder extends ReplayScreenshotRecorder {
   Future<void> stop() async {
     options.log(SentryLevel.debug, "$logName: stopping capture.");
     _status = _Status.stopped;
+    options.lifecycleRegistry
+      ..removeCallback<OnMemoryPressure>(_onMemoryPressure)
+      ..removeCallback<OnNavigation>(_onNavigation);
+    _stopAdaptiveFrameRate();
     await _stopScheduler();
     // await Future.wait([_stopScheduler(), _idleFrameFiller.stop()]);
     options.log(SentryLevel.debug, "$logName: capture stopped.");
@@ -120,8 +152,111 @@ class ScheduledScreenshotRecorder extends ReplayScreenshotRecorder {
     }
   }
 
+  Future<void> _capture(Duration _) {
+    if (_isAdaptive && _isOverFrameBudget()) {
+      if (_skippedCaptures < _maxSkippedCaptures) {
+        _skippedCaptures++;
+        return Future.value();
+      }
+    }
+    _skippedCaptures = 0;
+    return capture(_onImageCaptured);
+  }
+
+  void _startAdaptiveFrameRate() {
+    if (_isAdaptive) {
+      return;
+    }
+    final binding = options.bindingUtils.instance;
+    if (binding == null) {
+      return;
+    }
+    _isAdaptive = true;
+    binding.pointerRouter.addGlobalRoute(_onPointerEvent);
+    binding.addTimingsCallback(_onFrameTimings);
+  }
+
+  void _stopAdaptiveFrameRate() {
+    if (!_isAdaptive) {
+      return;
+    }
+    _isAdaptive = false;
+    final binding = options.bindingUtils.instance;
+    binding?.pointerRouter.removeGlobalRoute(_onPointerEvent);
+    binding?.removeTimingsCallback(_onFrameTimings);
+    _previousFrameHash = null;
+    _lastFrameTiming = null;
+  }
+
+  void _wakeUp() => _scheduler?.wakeUp();
+
+  /// Returns to the configured frame rate, the next screen likely differs.
+  void _onNavigation(OnNavigation event) {
+    if (_isAdaptive) {
+      _wakeUp();
+    }
+  }
+
+  @override
+  void clearCaches() {
+    super.clearCaches();
+    _previousFrameHash = null;
+  }
+
+  void _onMemoryPressure(OnMemoryPressure event) {
+    if (event.level.index > event.previous.index) {
+      clearCaches();
+    }
+  }
+
+  void _onPointerEvent(PointerEvent event) {
+    if (event is PointerDownEvent || event is PointerSignalEvent) {
+      _wakeUp();
+    }
+  }
+
+  void _onFrameTimings(List<FrameTiming> timings) {
+    if (timings.isNotEmpty) {
+      _lastFrameTiming = timings.last;
+    }
+  }
+
+  bool _isOverFrameBudget() {
+    final timing = _lastFrameTiming;
+    if (timing == null) {
+      return false;
+    }
+    final binding = options.bindingUtils.instance;
+    final budget = (binding is SentryWidgetsBindingMixin
+            ? binding.expectedFrameDuration
+            : null) ??
+        _defaultFrameBudget;
+    return timing.buildDuration > budget || timing.rasterDuration > budget;
+  }
+
+  static const _defaultFrameBudget = Duration(microseconds: 16667);
+
+  /// Slows down captures while consecutive screenshots look identical.
+  ///
+  /// This runs on the UI isolate for every capture, so only a sampled hash
+  /// of the frame is compared. The Android replay worker still compares
+  /// the full frames before handing them to the native SDK.
+  Future<void> _adaptToChanges(Screenshot screenshot) async {
+    final hash = Screenshot.sampledHash(await screenshot.rawRgbaData);
+    final previous = _previousFrameHash;
+    _previousFrameHash = hash;
+    if (previous == hash) {
+      _scheduler?.backOff();
+    } else {
+      _scheduler?.wakeUp();
+    }
+  }
+
   Future<void> _onImageCaptured(Screenshot screenshot) async {
     if (_status == _Status.running) {
+      if (_isAdaptive) {
+        await _adaptToChanges(screenshot);
+      }
       await _onScreenshot(screenshot, true);
       // _idleFrameFiller.actualFrameReceived(screenshot);
     } else {
@@ -1,3 +1,5 @@
+import 'dart:async';
+
 import 'package:flutter/scheduler.dart';
 import 'package:meta/meta.dart';
 
@@ -10,17 +12,33 @@ typedef SchedulerCallback = Future<void> Function(Duration);
 /// Instead, we manually schedule a callback with a given delay after the
 /// previous callback finished. Therefore, if the capture takes too long, we
 /// won't overload the system. We sacrifice the frame rate for performance.
+///
+/// The interval can be stretched with [backOff], e.g. while the captured
+/// content doesn't change, up to a maximum interval. [wakeUp] returns to the
+/// initial interval and runs the callback after the next frame.
 @internal
 class Scheduler {
   final SchedulerCallback _callback;
-  final Duration _interval;
+  final Duration _initialInterval;
+  final Duration _maxInterval;
+  Duration _interval;
   bool _running = false;
   Future<void>? _scheduled;
+  Timer? _timer;
+  Completer<void>? _timerCompleter;
   Future<void>? _runningCallback;
 
   final void Function(FrameCallback callback) _addPostFrameCallback;
 
-  Scheduler(this._interval, this._callback, this._addPostFrameCallback);
+  Scheduler(Duration interval, this._callback, this._addPostFrameCallback,
+      {Duration? maxInterval})
+      : _initialInterval = interval,
+        _interval = interval,
+        _maxInterval = (maxInterval == null || maxInterval < interval)
+            ? interval
+            : maxInterval;
+
+  Duration get interval => _interval;
 
   void start() {
     _running = true;
@@ -31,6 +49,7 @@ class Scheduler {
 
   Future<void> stop() async {
     _running = false;
+    _cancelTimer();
     final scheduled = _scheduled;
     _scheduled = null;
     if (scheduled != null) {
@@ -38,13 +57,49 @@ class Scheduler {
     }
   }
 
+  /// Doubles the interval, up to the max interval. Takes effect for the next
+  /// scheduled run.
+  void backOff() {
+    final doubled = _interval * 2;
+    _interval = doubled > _maxInterval ? _maxInterval : doubled;
+  }
+
+  /// Returns to the initial interval. If the next run is currently delayed
+  /// by a longer interval, it runs after the next frame instead.
+  void wakeUp() {
+    if (_interval == _initialInterval) {
+      return;
+    }
+    _interval = _initialInterval;
+    if (_running && _timer != null) {
+      _cancelTimer();
+      _scheduled = null;
+      _runAfterNextFrame();
+    }
+  }
+
   @pragma('vm:prefer-inline')
   void _scheduleNext() {
-    if (_running) {
-      _scheduled ??= Future.delayed(_interval, _runAfterNextFrame);
+    if (_running && _scheduled == null) {
+      final completer = Completer<void>();
+      _timerCompleter = completer;
+      _scheduled = completer.future;
+      _timer = Timer(_interval, () {
+        _timer = null;
+        _timerCompleter = null;
+        _runAfterNextFrame();
+        completer.complete();
+      });
     }
   }
 
+  void _cancelTimer() {
+    _timer?.cancel();
+    _timer = null;
+    _timerCompleter?.complete();
+    _timerCompleter = null;
+  }
+
   @pragma('vm:prefer-inline')
   void _runAfterNextFrame() {
     final runningCallback = _runningCallback ?? Future.value();
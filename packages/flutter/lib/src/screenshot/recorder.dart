@@ -7,6 +7,7 @@ import 'package:flutter/material.dart' as material;
 import 'package:flutter/rendering.dart';
 import 'package:flutter/widgets.dart' as widgets;
 import 'package:meta/meta.dart';
+import 'package:sentry/sentry.dart' show SdkOverheadStage;
 
 import '../sentry_flutter_options.dart';
 import '../sentry_privacy_options.dart';
@@ -28,17 +29,28 @@ class ScreenshotRecorder {
   bool _warningLogged = false;
   late final SentryMaskingConfig? _maskingConfig;
 
+  /// Reused across captures if masks are cached, see [WidgetFilter].
+  late final WidgetFilter? _cachingWidgetFilter;
+
   ScreenshotRecorder(this.options,
       {SentryPrivacyOptions? privacyOptions,
       this.logName = 'ScreenshotRecorder',
-      this.config}) {
+      this.config,
+      bool cacheMasks = false}) {
     privacyOptions ??= options.privacy;
 
     final maskingConfig =
         privacyOptions.buildMaskingConfig(options.runtimeChecker);
     _maskingConfig = maskingConfig.length > 0 ? maskingConfig : null;
+    _cachingWidgetFilter = cacheMasks && _maskingConfig != null
+        ? WidgetFilter(_maskingConfig, cacheMasks: true)
+        : null;
   }
 
+  /// Frees what is cached between captures, e.g. under memory pressure.
+  @mustCallSuper
+  void clearCaches() => _cachingWidgetFilter?.clearCache();
+
   void _logError(Object? e, StackTrace stackTrace) =>
       internalLogger.error('$logName: failed to capture screenshot.',
           error: e, stackTrace: stackTrace);
@@ -81,6 +93,9 @@ class ScreenshotRecorder {
         return Future.value(null);
       }
 
+      final overheadTimer =
+          // ignore: invalid_use_of_internal_member
+          options.sdkOverheadStats.start(SdkOverheadStage.screenshot);
       final capture = _Capture<R>.create(renderObject, config!, context);
 
       Timeline.startSync('Sentry::captureScreenshot:RenderObjectToImage',
@@ -103,6 +118,7 @@ class ScreenshotRecorder {
           capture._completer.complete(null);
         }
       });
+      overheadTimer?.stop();
       Timeline.finishSync(); // Sentry::captureScreenshot
       return capture.future;
     } catch (e, stackTrace) {
@@ -129,14 +145,18 @@ class ScreenshotRecorder {
 
   List<WidgetFilterItem>? _obscureSync(_Capture<dynamic> capture) {
     if (_maskingConfig != null) {
-      final filter = WidgetFilter(_maskingConfig);
+      final filter = _cachingWidgetFilter ?? WidgetFilter(_maskingConfig);
       final colorScheme = capture.context.findColorScheme();
       filter.obscure(
         root: capture.root,
         context: capture.context,
         colorScheme: colorScheme,
       );
-      return filter.items;
+      // A reused filter overwrites its items on the next capture, while
+      // these are used asynchronously.
+      return _cachingWidgetFilter == null
+          ? filter.items
+          : List.of(filter.items);
     }
     return null;
   }
@@ -73,44 +73,60 @@ class Screenshot {
     }
   }
 
-  /// Efficiently compares two memory regions for data equality..
-  @visibleForTesting
+  /// Number of pixels read by [sampledHash].
+  static const _hashSamples = 4096;
+
+  /// A cheap fingerprint of [data]: a hash of up to 4096 RGBA pixels spread
+  /// over the whole frame. Unlike [listEquals], it doesn't read every byte
+  /// and doesn't need the previous frame to be kept. Changes between the
+  /// sampled pixels go unnoticed.
+  static int sampledHash(ByteData data) {
+    final pixels = data.lengthInBytes ~/ 4;
+    // An odd step, so the samples don't line up in the same columns.
+    final step = (pixels ~/ _hashSamples) | 1;
+    var hash = data.lengthInBytes;
+    for (var i = 0; i < pixels; i += step) {
+      hash = (hash * 31 + data.getUint32(i * 4)) & 0x3fffffff;
+    }
+    return hash;
+  }
+
+  /// Efficiently compares two memory regions for data equality, in chunks
+  /// of 8 bytes where the regions are aligned for it.
   static bool listEquals(ByteData dataA, ByteData dataB) {
     if (identical(dataA, dataB)) {
       return true;
     }
-    if (dataA.lengthInBytes != dataB.lengthInBytes) {
+    final length = dataA.lengthInBytes;
+    if (length != dataB.lengthInBytes) {
       return false;
     }
 
-    /// Ideally, we would use memcmp with Uint8List.address but that's only
-    /// available since Dart 3.5.0. The relevant code is commented out below and
-    /// Should be used once we can bump the Dart SDK in the next major version.
-    /// For now, the best we can do is compare by chunks of 8 bytes.
-    // return 0 == memcmp(dataA.address, dataB.address, dataA.lengthInBytes);
-
-    late final int processed;
-    try {
-      final numWords = dataA.lengthInBytes ~/ 8;
-      final wordsA = dataA.buffer.asUint64List(0, numWords);
-      final wordsB = dataB.buffer.asUint64List(0, numWords);
-
-      for (var i = 0; i < wordsA.length; i++) {
-        if (wordsA[i] != wordsB[i]) {
-          return false;
+    var processed = 0;
+    if (dataA.offsetInBytes % 8 == 0 && dataB.offsetInBytes % 8 == 0) {
+      try {
+        final numWords = length ~/ 8;
+        final wordsA = dataA.buffer.asUint64List(dataA.offsetInBytes, numWords);
+        final wordsB = dataB.buffer.asUint64List(dataB.offsetInBytes, numWords);
+
+        for (var i = 0; i < numWords; i++) {
+          if (wordsA[i] != wordsB[i]) {
+            return false;
+          }
         }
+        processed = numWords * 8;
+      } on UnsupportedError {
+        // This should only trigger on dart2js:
+        // Unsupported operation: Uint64List not supported by dart2js.
       }
-      processed = wordsA.lengthInBytes;
-    } on UnsupportedError {
-      // This should only trigger on dart2js:
-      // Unsupported operation: Uint64List not supported by dart2js.
-      processed = 0;
     }
 
     // Compare any remaining bytes.
-    final bytesA = dataA.buffer.asUint8List(processed);
-    final bytesB = dataB.buffer.asUint8List(processed);
-    for (var i = 0; i < bytesA.lengthInBytes; i++) {
+    final bytesA = dataA.buffer
+        .asUint8List(dataA.offsetInBytes + processed, length - processed);
+    final bytesB = dataB.buffer
+        .asUint8List(dataB.offsetInBytes + processed, length - processed);
+    for (var i = 0; i < bytesA.length; i++) {
       if (bytesA[i] != bytesB[i]) {
         return false;
       }
@@ -119,9 +135,3 @@ class Screenshot {
     return true;
   }
 }
-
-// /// Compares the first num bytes of the block of memory pointed by ptr1 to the
-// /// first num bytes pointed by ptr2, returning zero if they all match or a value
-// ///  different from zero representing which is greater if they do not.
-// @Native<Int32 Function(Pointer, Pointer, Int32)>(symbol: 'memcmp', isLeaf: true)
-// external int memcmp(Pointer<Uint8> ptr1, Pointer<Uint8> ptr2, int len);
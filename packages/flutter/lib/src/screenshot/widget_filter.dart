@@ -16,12 +16,22 @@ class WidgetFilter {
   late Rect _bounds;
   late List<Element> _visitList;
   final _warnedWidgets = <int>{};
+  final _MaskCache? _cache;
 
   /// Used to test _obscureElementOrParent
   @visibleForTesting
   bool throwInObscure = false;
 
-  WidgetFilter(this.config);
+  /// With [cacheMasks], the mask items of subtrees below repaint boundaries
+  /// are kept between calls to [obscure] and reused as long as nothing in the
+  /// subtree has been repainted and the boundary has not moved. This is meant
+  /// for filters that run on every replay frame.
+  WidgetFilter(this.config, {bool cacheMasks = false})
+      : _cache = cacheMasks ? _MaskCache() : null;
+
+  /// Forgets the cached masks, the next call to [obscure] visits the whole
+  /// tree again.
+  void clearCache() => _cache?.clear();
 
   void obscure({
     required RenderRepaintBoundary root,
@@ -39,6 +49,12 @@ class WidgetFilter {
     // clear the output list
     items.clear();
 
+    final cache = _cache;
+    if (cache != null) {
+      _obscureWithCache(context, cache);
+      return;
+    }
+
     // Reset the list of elements we're going to process.
     // Then do a breadth-first tree traversal on all the widgets.
     // TODO benchmark performance compared to to DoubleLinkedQueue.
@@ -51,12 +67,124 @@ class WidgetFilter {
       _visitList = [];
 
       for (final element in currentList) {
-        _process(element);
+        if (_process(element)) {
+          element.debugVisitOnstageChildren(_visitList.add);
+        }
+      }
+    }
+  }
+
+  /// Same breadth-first traversal as [obscure], but subtrees below unchanged
+  /// repaint boundaries are not visited again. Their items are replayed from
+  /// the cache level by level so the order of [items] stays the same as
+  /// without the cache.
+  void _obscureWithCache(BuildContext context, _MaskCache cache) {
+    cache.begin(_root, _bounds, _scheme);
+
+    final rootTransform = Matrix4.identity();
+    final cachedRoot = cache.reuse(_root, rootTransform);
+    if (cachedRoot != null) {
+      for (final level in cachedRoot.levels) {
+        items.addAll(level);
+      }
+      cache.end();
+      return;
+    }
+
+    var current = _CachedVisitList();
+    final rootRecording = cache.record(_root, rootTransform, null, 0);
+    final contextRenderObject =
+        context is RenderObjectElement ? context.renderObject : null;
+    context.visitChildElements(
+        (child) => current.add(child, contextRenderObject, rootRecording));
+
+    var level = 0;
+    while (current.isNotEmpty) {
+      final next = _CachedVisitList();
+      for (var i = 0; i < current.length; i++) {
+        final entry = current.entries[i];
+        final recording = current.recordings[i];
+
+        if (entry is _CachedLevel) {
+          for (final item in entry.items) {
+            _add(item, recording, level);
+          }
+          final nextLevel = entry.next();
+          if (nextLevel != null) {
+            next.add(nextLevel, null, recording);
+          }
+          continue;
+        }
+
+        final element = entry as Element;
+        var renderParent = current.renderParents[i];
+        RenderObject? boundary;
+        if (element is RenderObjectElement) {
+          final renderObject = element.renderObject;
+          final isAttachedHere = renderParent == null
+              ? identical(renderObject, _root)
+              : identical(renderObject.parent, renderParent);
+          if (!isAttachedHere) {
+            // Rendered elsewhere (e.g. an overlay portal), so its changes
+            // don't show up in the layers of the enclosing boundaries.
+            recording?.invalidate();
+          } else if (renderObject.isRepaintBoundary &&
+              !identical(renderObject, _root)) {
+            boundary = renderObject;
+          }
+          renderParent = renderObject;
+        }
+
+        if (!_process(element, recording, level)) {
+          continue;
+        }
+
+        var childRecording = recording;
+        if (boundary != null) {
+          final transform = _transformToRoot(boundary);
+          if (transform != null) {
+            final cached = cache.reuse(boundary, transform);
+            if (cached != null) {
+              cache.reused(cached, recording);
+              final firstLevel = _CachedLevel.first(cached);
+              if (firstLevel != null) {
+                next.add(firstLevel, null, recording);
+              }
+              continue;
+            }
+            childRecording =
+                cache.record(boundary, transform, recording, level + 1);
+          }
+        }
+
+        element.debugVisitOnstageChildren(
+            (child) => next.add(child, renderParent, childRecording));
       }
+      current = next;
+      level++;
     }
+
+    cache.end();
   }
 
-  void _process(Element element) {
+  @pragma('vm:prefer-inline')
+  void _add(WidgetFilterItem item, _Recording? recording, int level) {
+    items.add(item);
+    for (var r = recording; r != null; r = r.parent) {
+      r.add(level, item);
+    }
+  }
+
+  Matrix4? _transformToRoot(RenderObject renderObject) {
+    try {
+      return renderObject.getTransformTo(_root);
+    } catch (_) {
+      return null;
+    }
+  }
+
+  /// Returns whether the children of [element] should be visited.
+  bool _process(Element element, [_Recording? recording, int level = 0]) {
     final widget = element.widget;
 
     if (!_isVisible(widget)) {
@@ -64,27 +192,26 @@ class WidgetFilter {
         internalLogger.debug("WidgetFilter skipping invisible: $widget");
         return true;
       }());
-      return;
+      return false;
     }
 
     final decision = config.shouldMask(element, widget);
     switch (decision) {
       case SentryMaskingDecision.mask:
-        final item = _obscureElementOrParent(element, widget);
+        final item = _obscureElementOrParent(element, widget, recording);
         if (item != null) {
-          items.add(item);
+          _add(item, recording, level);
         }
-        break;
+        return false;
       case SentryMaskingDecision.unmask:
         assert(() {
           internalLogger.debug("WidgetFilter unmasked: $widget");
           return true;
         }());
-        break;
+        return false;
       case SentryMaskingDecision.continueProcessing:
         // If this element should not be obscured, visit and check its children.
-        element.debugVisitOnstageChildren(_visitList.add);
-        break;
+        return true;
     }
   }
 
@@ -92,11 +219,14 @@ class WidgetFilter {
   /// If the widget is offscreen, returns null.
   /// If the widget cannot be obscured, obscures the parent.
   @pragma('vm:prefer-inline')
-  WidgetFilterItem? _obscureElementOrParent(Element element, Widget widget) {
+  WidgetFilterItem? _obscureElementOrParent(Element element, Widget widget,
+      [_Recording? recording]) {
     while (true) {
       try {
         return _obscure(element, widget);
       } catch (e, stackTrace) {
+        // The parent may be outside of the cached subtree.
+        recording?.invalidate();
         final parent = element.parent;
         if (!_warnedWidgets.contains(widget.hashCode)) {
           _warnedWidgets.add(widget.hashCode);
@@ -262,4 +392,275 @@ class WidgetFilterColorScheme {
       {required this.defaultMask,
       required this.defaultTextMask,
       required this.background});
+
+  @override
+  bool operator ==(Object other) =>
+      other is WidgetFilterColorScheme &&
+      other.defaultMask == defaultMask &&
+      other.defaultTextMask == defaultTextMask &&
+      other.background == background;
+
+  @override
+  int get hashCode => Object.hash(defaultMask, defaultTextMask, background);
+}
+
+/// Mask items of unchanged subtrees, kept between [WidgetFilter.obscure]
+/// calls.
+///
+/// A subtree is identified by its repaint boundary. Its items are reused if
+/// the layers below the boundary are the same layers with the same
+/// properties as in the previous call, i.e. nothing in the subtree has been
+/// laid out or painted again, and the boundary is at the same position
+/// relative to the root. Layout changes always cause a repaint, so this
+/// covers changes to the size and position of the masked widgets as well.
+///
+/// A rebuild that doesn't change anything on screen doesn't invalidate the
+/// cache. Masks then stay as they were for exactly the same pixels.
+class _MaskCache {
+  RenderObject? _root;
+  Rect? _bounds;
+  WidgetFilterColorScheme? _scheme;
+
+  /// Layer states of the current and the previous call.
+  var _layers = Map<Layer, _LayerState>.identity();
+  var _previousLayers = Map<Layer, _LayerState>.identity();
+
+  /// Cached subtrees by repaint boundary, of the current and previous call.
+  var _subtrees = Map<RenderObject, _CachedSubtree>.identity();
+  var _previousSubtrees = Map<RenderObject, _CachedSubtree>.identity();
+
+  final _recordings = <_Recording>[];
+
+  void clear() {
+    _root = null;
+    _layers.clear();
+    _previousLayers.clear();
+    _subtrees.clear();
+    _previousSubtrees.clear();
+  }
+
+  void begin(RenderObject root, Rect bounds, WidgetFilterColorScheme scheme) {
+    if (!identical(root, _root) || bounds != _bounds || scheme != _scheme) {
+      _root = root;
+      _bounds = bounds;
+      _scheme = scheme;
+      _previousSubtrees.clear();
+    }
+    // ignore: invalid_use_of_protected_member
+    final rootLayer = root.layer;
+    if (rootLayer != null) {
+      _scan(rootLayer);
+    }
+  }
+
+  /// Records the state of [layer] and its descendants and returns whether
+  /// all of them are unchanged since the previous call.
+  bool _scan(Layer layer) {
+    final previous = _previousLayers[layer];
+    final properties = _properties(layer);
+    var clean = previous != null && previous.properties == properties;
+
+    List<Layer>? children;
+    if (layer is ContainerLayer) {
+      children = [];
+      final previousChildren = previous?.children;
+      for (var child = layer.firstChild;
+          child != null;
+          child = child.nextSibling) {
+        final index = children.length;
+        if (previousChildren == null ||
+            index >= previousChildren.length ||
+            !identical(previousChildren[index], child)) {
+          clean = false;
+        }
+        children.add(child);
+        // Always scan the whole tree to record the state for the next call.
+        if (!_scan(child)) {
+          clean = false;
+        }
+      }
+      if (previousChildren?.length != children.length) {
+        clean = false;
+      }
+    }
+
+    _layers[layer] = _LayerState(properties, children, clean);
+    return clean;
+  }
+
+  /// The properties of a layer that can change without the layer being
+  /// replaced and that affect where and whether its content is visible.
+  static Object? _properties(Layer layer) => switch (layer) {
+        TransformLayer(:final offset, :final transform) => (
+            offset,
+            transform == null ? null : Matrix4.copy(transform)
+          ),
+        OpacityLayer(:final offset, :final alpha) => (offset, alpha),
+        OffsetLayer(:final offset) => offset,
+        ClipRectLayer(:final clipRect) => clipRect,
+        ClipRRectLayer(:final clipRRect) => clipRRect,
+        ClipPathLayer(:final clipPath) => clipPath,
+        PictureLayer(:final picture) => picture,
+        _ => null,
+      };
+
+  /// Returns the cached subtree of [boundary] if it can be reused.
+  _CachedSubtree? reuse(RenderObject boundary, Matrix4 transform) {
+    final cached = _previousSubtrees[boundary];
+    if (cached == null) {
+      return null;
+    }
+    // ignore: invalid_use_of_protected_member
+    final layer = boundary.layer;
+    if (layer == null ||
+        !identical(layer, cached.layer) ||
+        _layers[layer]?.clean != true ||
+        transform != cached.transform) {
+      return null;
+    }
+    _keep(cached);
+    return cached;
+  }
+
+  /// Registers [cached], which is reused within [recording], as a nested
+  /// subtree of [recording].
+  void reused(_CachedSubtree cached, _Recording? recording) {
+    recording?.nested.add(cached);
+  }
+
+  /// Starts recording the items of the subtree of [boundary]. Returns null
+  /// if [boundary] has not been painted.
+  _Recording? record(RenderObject boundary, Matrix4 transform,
+      _Recording? parent, int level) {
+    // ignore: invalid_use_of_protected_member
+    final layer = boundary.layer;
+    if (layer == null) {
+      return parent;
+    }
+    final recording = _Recording(boundary, layer, transform, parent, level);
+    _recordings.add(recording);
+    return recording;
+  }
+
+  void end() {
+    // Nested recordings are always started after their parents, so going
+    // backwards completes them first.
+    for (final recording in _recordings.reversed) {
+      if (!recording.valid) {
+        continue;
+      }
+      final cached = _CachedSubtree(
+        recording.boundary,
+        recording.layer,
+        recording.transform,
+        recording.levels,
+        recording.nested,
+      );
+      _subtrees[recording.boundary] = cached;
+      recording.parent?.nested.add(cached);
+    }
+    _recordings.clear();
+
+    final previousLayers = _previousLayers;
+    _previousLayers = _layers;
+    _layers = previousLayers..clear();
+
+    final previousSubtrees = _previousSubtrees;
+    _previousSubtrees = _subtrees;
+    _subtrees = previousSubtrees..clear();
+  }
+
+  /// Keeps [cached] and all subtrees nested in it for the next call.
+  void _keep(_CachedSubtree cached) {
+    _subtrees[cached.boundary] = cached;
+    cached.nested.forEach(_keep);
+  }
+}
+
+class _LayerState {
+  final Object? properties;
+  final List<Layer>? children;
+  final bool clean;
+
+  _LayerState(this.properties, this.children, this.clean);
+}
+
+class _CachedSubtree {
+  final RenderObject boundary;
+  final Layer layer;
+  final Matrix4 transform;
+
+  /// Items by breadth-first level, relative to the boundary's children.
+  final List<List<WidgetFilterItem>> levels;
+  final List<_CachedSubtree> nested;
+
+  _CachedSubtree(
+      this.boundary, this.layer, this.transform, this.levels, this.nested);
+}
+
+class _Recording {
+  final RenderObject boundary;
+  final Layer layer;
+  final Matrix4 transform;
+  final _Recording? parent;
+
+  /// The traversal level of the boundary's children.
+  final int level;
+  final levels = <List<WidgetFilterItem>>[];
+  final nested = <_CachedSubtree>[];
+  bool valid = true;
+
+  _Recording(
+      this.boundary, this.layer, this.transform, this.parent, this.level);
+
+  void add(int level, WidgetFilterItem item) {
+    final index = level - this.level;
+    while (levels.length <= index) {
+      levels.add([]);
+    }
+    levels[index].add(item);
+  }
+
+  /// Marks this recording and all enclosing ones as not cacheable.
+  void invalidate() {
+    for (_Recording? r = this; r != null && r.valid; r = r.parent) {
+      r.valid = false;
+    }
+  }
+}
+
+/// A level of cached items, replayed in place of the subtree's elements.
+class _CachedLevel {
+  final _CachedSubtree subtree;
+  final int index;
+
+  _CachedLevel._(this.subtree, this.index);
+
+  static _CachedLevel? first(_CachedSubtree subtree) =>
+      subtree.levels.isEmpty ? null : _CachedLevel._(subtree, 0);
+
+  List<WidgetFilterItem> get items => subtree.levels[index];
+
+  _CachedLevel? next() => index + 1 < subtree.levels.length
+      ? _CachedLevel._(subtree, index + 1)
+      : null;
+}
+
+/// The elements (or cached levels) of one traversal level, together with
+/// the render object they are expected to be attached to and the recording
+/// they belong to.
+class _CachedVisitList {
+  final entries = <Object>[];
+  final renderParents = <RenderObject?>[];
+  final recordings = <_Recording?>[];
+
+  int get length => entries.length;
+
+  bool get isNotEmpty => entries.isNotEmpty;
+
+  void add(Object entry, RenderObject? renderParent, _Recording? recording) {
+    entries.add(entry);
+    renderParents.add(renderParent);
+    recordings.add(recording);
+  }
 }
@@ -23,6 +23,9 @@ import 'feedback/sentry_feedback_options.dart';
 class SentryFlutterOptions extends SentryOptions {
   SentryFlutterOptions({super.dsn, super.platform, super.checker}) {
     enableBreadcrumbTrackingForCurrentPlatform();
+    // The app keeps running until it is closed anyway, so polling doesn't
+    // keep it alive.
+    enableCgroupMemoryPressure = true;
   }
 
   /// Initializes the Native SDKs on init.
@@ -280,6 +283,30 @@ class SentryFlutterOptions extends SentryOptions {
   /// Default: `true`
   bool reportViewHierarchyIdentifiers = true;
 
+  /// Maximum number of elements captured in the view hierarchy. Elements
+  /// beyond the limit are left out.
+  ///
+  /// Default: `null` (no limit)
+  @meta.experimental
+  int? viewHierarchyMaxNodes;
+
+  /// Maximum depth of the captured view hierarchy, relative to the root
+  /// element. Deeper elements are left out.
+  ///
+  /// Default: `null` (no limit)
+  @meta.experimental
+  int? viewHierarchyMaxDepth;
+
+  /// When set, the view hierarchy is captured incrementally: the element tree
+  /// is walked for at most this duration at a time and the walk resumes after
+  /// yielding to the UI, so that frames can be rendered in between.
+  ///
+  /// Elements removed from the tree while the walk is paused are skipped.
+  ///
+  /// Default: `null` (the tree is walked in one go)
+  @meta.experimental
+  Duration? viewHierarchyFrameBudget;
+
   /// When enabled, the SDK tracks when the application stops responding for a
   /// specific amount of time, See [appHangTimeoutInterval].
   /// Only available on iOS and macOS.
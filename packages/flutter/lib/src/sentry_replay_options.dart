@@ -78,6 +78,16 @@ class SentryReplayOptions {
   /// more CPU load, defaults to MEDIUM.
   var quality = SentryReplayQuality.medium;
 
+  /// Whether screenshots are captured less often while the screen doesn't
+  /// change. The interval between captures doubles with every unchanged
+  /// screenshot, up to 5 seconds, and returns to the configured frame rate on
+  /// user input, navigation or when the screen changes. Captures are also
+  /// skipped while the app is missing its frame budget.
+  ///
+  /// Only supported on Android at the moment. Defaults to false.
+  @experimental
+  bool adaptiveFrameRate = false;
+
   @internal
   bool get isEnabled =>
       ((sessionSampleRate ?? 0) > 0) || ((onErrorSampleRate ?? 0) > 0);
@@ -209,15 +209,68 @@ import '../widget_utils.dart';
 class _TreeWalker {
   static const _privateDelimiter = '_';
 
-  _TreeWalker(this.rootElement, this.options);
+  _TreeWalker(this.rootElement, this.options)
+      : _maxNodes = options.viewHierarchyMaxNodes,
+        _maxDepth = options.viewHierarchyMaxDepth;
 
   final Element rootElement;
   final SentryFlutterOptions options;
+  final int? _maxNodes;
+  final int? _maxDepth;
+
+  /// Elements still to be visited, in reverse visiting order. The walk is
+  /// iterative so that it can be paused and resumed across frames.
+  final List<_PendingElement> _pending = [];
+  final List<Element> _children = [];
+  int _nodeCount = 0;
+  late final SentryViewHierarchyElement _sentryRootElement;
+
+  void _start() {
+    _sentryRootElement = _toSentryViewHierarchyElement(rootElement);
+    _nodeCount = 1;
+    _pushChildren(rootElement, _sentryRootElement, 0);
+  }
+
+  void _pushChildren(
+    Element element,
+    SentryViewHierarchyElement parentSentryElement,
+    int depth,
+  ) {
+    final maxDepth = _maxDepth;
+    if (maxDepth != null && depth >= maxDepth) {
+      return;
+    }
+    final children = _children..clear();
+    element.visitChildElements(children.add);
+    // Pushed in reverse so that the first child is visited first.
+    for (var i = children.length - 1; i >= 0; i--) {
+      _pending.add(_PendingElement(children[i], parentSentryElement, depth + 1));
+    }
+    children.clear();
+  }
+
+  /// Visits pending elements until the tree is exhausted, the node limit is
+  /// reached or [shouldPause] returns true. Returns true once done.
+  bool _walk({bool Function()? shouldPause}) {
+    final maxNodes = _maxNodes;
+    while (_pending.isNotEmpty) {
+      if (maxNodes != null && _nodeCount >= maxNodes) {
+        _pending.clear();
+        break;
+      }
+      if (shouldPause != null && shouldPause()) {
+        return false;
+      }
+
+      final pending = _pending.removeLast();
+      final element = pending.element;
+      // The tree may have changed while the walk was paused.
+      if (!element.mounted) {
+        continue;
+      }
 
-  ValueChanged<Element> _visitor(
-      SentryViewHierarchyElement parentSentryElement) {
-    return (Element element) {
       final sentryElement = _toSentryViewHierarchyElement(element);
+      _nodeCount++;
 
       var privateElement = false;
       // when obfuscation is enabled, this won't work because all the types
@@ -226,24 +279,47 @@ class _TreeWalker {
           (sentryElement.identifier?.startsWith(_privateDelimiter) ?? false)) {
         privateElement = true;
       } else {
-        parentSentryElement.children.add(sentryElement);
+        pending.parent.children.add(sentryElement);
       }
 
       // we don't want to add private children but we still want to walk the tree
-      element.visitChildElements(
-          _visitor(privateElement ? parentSentryElement : sentryElement));
-    };
+      _pushChildren(
+        element,
+        privateElement ? pending.parent : sentryElement,
+        pending.depth,
+      );
+    }
+    return true;
   }
 
-  SentryViewHierarchy? toSentryViewHierarchy() {
-    final sentryRootElement = _toSentryViewHierarchyElement(rootElement);
-    rootElement.visitChildElements(_visitor(sentryRootElement));
-
+  SentryViewHierarchy _toSentryViewHierarchy() {
     final sentryViewHierarchy = SentryViewHierarchy('flutter');
-    sentryViewHierarchy.windows.add(sentryRootElement);
+    sentryViewHierarchy.windows.add(_sentryRootElement);
     return sentryViewHierarchy;
   }
 
+  SentryViewHierarchy? toSentryViewHierarchy() {
+    _start();
+    _walk();
+    return _toSentryViewHierarchy();
+  }
+
+  /// Walks the tree in slices of at most [frameBudget], yielding to the
+  /// event loop between slices so that frames can be rendered in between.
+  Future<SentryViewHierarchy?> toSentryViewHierarchyIncrementally(
+      Duration frameBudget) async {
+    final budgetMicroseconds = frameBudget.inMicroseconds;
+    final stopwatch = Stopwatch()..start();
+    bool shouldPause() => stopwatch.elapsedMicroseconds >= budgetMicroseconds;
+
+    _start();
+    while (!_walk(shouldPause: shouldPause)) {
+      await Future<void>.delayed(Duration.zero);
+      stopwatch.reset();
+    }
+    return _toSentryViewHierarchy();
+  }
+
   SentryViewHierarchyElement _toSentryViewHierarchyElement(Element element) {
     final widget = element.widget;
 
@@ -255,7 +331,9 @@ class _TreeWalker {
     double? alpha;
 
     final renderObject = element.renderObject;
-    if (renderObject is RenderBox && renderObject.hasSize) {
+    if (renderObject is RenderBox &&
+        renderObject.attached &&
+        renderObject.hasSize) {
       final offset = renderObject.localToGlobal(Offset.zero);
       if (offset.dx > 0) {
         x = offset.dx;
@@ -298,11 +376,17 @@ class _TreeWalker {
   }
 }
 
+class _PendingElement {
+  _PendingElement(this.element, this.parent, this.depth);
+
+  final Element element;
+  final SentryViewHierarchyElement parent;
+  final int depth;
+}
+
 SentryViewHierarchy? walkWidgetTree(
     WidgetsBinding instance, SentryFlutterOptions options) {
-  // to keep compatibility with older versions
-  // ignore: deprecated_member_use
-  final rootElement = instance.renderViewElement;
+  final rootElement = _rootElement(instance);
   if (rootElement == null) {
     return null;
   }
@@ -311,3 +395,29 @@ SentryViewHierarchy? walkWidgetTree(
 
   return walker.toSentryViewHierarchy();
 }
+
+/// Like [walkWidgetTree], but spreads the walk across frames, spending at
+/// most [SentryFlutterOptions.viewHierarchyFrameBudget] per frame. Walks
+/// synchronously if no budget is set.
+Future<SentryViewHierarchy?> walkWidgetTreeIncrementally(
+    WidgetsBinding instance, SentryFlutterOptions options) async {
+  final frameBudget = options.viewHierarchyFrameBudget;
+  if (frameBudget == null) {
+    return walkWidgetTree(instance, options);
+  }
+
+  final rootElement = _rootElement(instance);
+  if (rootElement == null) {
+    return null;
+  }
+
+  final walker = _TreeWalker(rootElement, options);
+
+  return walker.toSentryViewHierarchyIncrementally(frameBudget);
+}
+
+Element? _rootElement(WidgetsBinding instance) {
+  // to keep compatibility with older versions
+  // ignore: deprecated_member_use
+  return instance.renderViewElement;
+}
@@ -1,17 +1,33 @@
 import 'dart:async';
 
+import 'package:flutter/widgets.dart';
+import 'package:meta/meta.dart';
+
 import '../../sentry_flutter.dart';
+import '../binding_wrapper.dart';
 import '../utils/debouncer.dart';
 import 'sentry_tree_walker.dart';
 
+@visibleForTesting
+typedef ViewHierarchyWalker = Future<SentryViewHierarchy?> Function(
+    WidgetsBinding instance, SentryFlutterOptions options);
+
 /// A [EventProcessor] that renders an ASCII representation of the entire view
 /// hierarchy of the application when an error happens and includes it as an
 /// attachment to the [Hint].
 class SentryViewHierarchyEventProcessor implements EventProcessor {
   final SentryFlutterOptions _options;
+  final ViewHierarchyWalker _walker;
   late final Debouncer _debouncer;
 
-  SentryViewHierarchyEventProcessor(this._options) {
+  SentryViewHierarchy? _cachedViewHierarchy;
+  int? _cachedAtFrame;
+  _WalkOptions? _cachedWalkOptions;
+
+  SentryViewHierarchyEventProcessor(
+    this._options, {
+    @visibleForTesting ViewHierarchyWalker? walker,
+  }) : _walker = walker ?? walkWidgetTreeIncrementally {
     _debouncer = Debouncer(
       // ignore: invalid_use_of_internal_member
       _options.clock,
@@ -77,7 +93,7 @@ class SentryViewHierarchyEventProcessor implements EventProcessor {
       }
     }
 
-    final sentryViewHierarchy = walkWidgetTree(instance, _options);
+    final sentryViewHierarchy = await _captureViewHierarchy(instance);
     if (sentryViewHierarchy == null) {
       return event;
     }
@@ -85,4 +101,40 @@ class SentryViewHierarchyEventProcessor implements EventProcessor {
         SentryAttachment.fromViewHierarchy(sentryViewHierarchy);
     return event;
   }
+
+  /// Walks the widget tree, or reuses the previous result if no frame has
+  /// been rendered since and the walk options are the same, as the tree
+  /// cannot have been rebuilt in between.
+  Future<SentryViewHierarchy?> _captureViewHierarchy(
+      WidgetsBinding instance) async {
+    final walkOptions = (
+      withIdentifiers: _options.reportViewHierarchyIdentifiers,
+      maxNodes: _options.viewHierarchyMaxNodes,
+      maxDepth: _options.viewHierarchyMaxDepth,
+      frameBudget: _options.viewHierarchyFrameBudget,
+    );
+    final startFrame = renderedFrameCount(instance);
+    final cached = _cachedViewHierarchy;
+    if (cached != null &&
+        _cachedAtFrame == startFrame &&
+        _cachedWalkOptions == walkOptions) {
+      return cached;
+    }
+
+    final sentryViewHierarchy = await _walker(instance, _options);
+
+    // Only cache results that were captured without a frame in between.
+    final isConsistent = startFrame == renderedFrameCount(instance);
+    _cachedViewHierarchy = isConsistent ? sentryViewHierarchy : null;
+    _cachedAtFrame = startFrame;
+    _cachedWalkOptions = walkOptions;
+    return sentryViewHierarchy;
+  }
 }
+
+typedef _WalkOptions = ({
+  bool withIdentifiers,
+  int? maxNodes,
+  int? maxDepth,
+  Duration? frameBudget,
+});
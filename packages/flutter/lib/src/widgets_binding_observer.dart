@@ -182,8 +182,12 @@ class SentryWidgetsBindingObserver with WidgetsBindingObserver {
 
   /// A call to this method indicates that the operating system would like
   /// applications to release caches to free up more memory.
+  ///
+  /// The SDK sheds its own caches and buffers, see [MemoryGovernor].
   @override
   void didHaveMemoryPressure() {
+    _options.memoryGovernor.escalate(MemoryPressureLevel.high);
+
     if (!_options.enableMemoryPressureBreadcrumbs) {
       return;
     }
@@ -3,6 +3,9 @@ import 'src/image_bench.dart' as image_bench;
 import 'src/memory_bench.dart' as memory_bench;
 import 'src/jni_bench.dart' as jni_bench;
 import 'src/envelope_builder_bench.dart' as envelope_builder_bench;
+import 'src/id_bench.dart' as id_bench;
+import 'src/view_hierarchy_bench.dart' as view_hierarchy_bench;
+import 'src/capture_bench.dart' as capture_bench;
 
 typedef BenchmarkSet = (String name, Future<void> Function() callback);
 
@@ -13,7 +16,10 @@ Future<void> main() async {
     ('Image', image_bench.execute),
     ('Memory', memory_bench.execute),
     if (Platform.isAndroid) ('JNI', jni_bench.execute),
-    ('Envelope builder', envelope_builder_bench.execute)
+    ('Envelope builder', envelope_builder_bench.execute),
+    ('ID generation', id_bench.execute),
+    ('View hierarchy', view_hierarchy_bench.execute),
+    ('Capture', capture_bench.execute),
   ];
 
   RegExp? filterRegexp;
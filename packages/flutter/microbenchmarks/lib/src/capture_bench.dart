@@ -0,0 +1,54 @@
+import 'dart:async';
+
+import 'package:benchmarking/benchmarking.dart';
+import 'package:sentry_flutter/sentry_flutter.dart';
+
+const _events = 10000;
+
+Future<void> execute() async {
+  // Sentry.init (not SentryFlutter.init) keeps the custom transport, so the
+  // default event processors run but nothing leaves the process.
+  await Sentry.init((options) {
+    options
+      ..dsn = 'https://abc@def.ingest.sentry.io/1234567'
+      ..transport = _NoOpTransport();
+  });
+
+  // Time until the event is handed to the transport: with only synchronous
+  // event processors and callbacks, this is the whole capture pipeline.
+  syncBenchmark('captureMessage() until handoff', () {
+    unawaited(Sentry.captureMessage('bench'));
+  }).report();
+
+  (await asyncBenchmark('await captureMessage()', () async {
+    await Sentry.captureMessage('bench');
+  }))
+      .report();
+
+  // Every async hop schedules a microtask and allocates the futures and
+  // continuations behind it, so this tracks the async overhead per event.
+  var microtasks = 0;
+  await runZoned(
+    () async {
+      for (var i = 0; i < _events; i++) {
+        await Sentry.captureMessage('bench');
+      }
+    },
+    zoneSpecification: ZoneSpecification(
+      scheduleMicrotask: (self, parent, zone, f) {
+        microtasks++;
+        parent.scheduleMicrotask(zone, f);
+      },
+    ),
+  );
+  print('Microtasks per captured event: '
+      '${(microtasks / _events).toStringAsFixed(2)}');
+
+  await Sentry.close();
+}
+
+class _NoOpTransport implements Transport {
+  @override
+  Future<SentryId?> send(SentryEnvelope envelope) async =>
+      envelope.header.eventId;
+}
@@ -0,0 +1,28 @@
+import 'package:benchmarking/benchmarking.dart';
+import 'package:sentry_flutter/sentry_flutter.dart';
+
+const _spansPerTransaction = 100;
+
+Future<void> execute() async {
+  syncBenchmark('SentryId.newId()', () => SentryId.newId()).report();
+  syncBenchmark('SpanId.newId()', () => SpanId.newId()).report();
+  syncBenchmark('SentryId.newId().toString()',
+      () => SentryId.newId().toString()).report();
+  syncBenchmark('SpanId.newId().toString()', () => SpanId.newId().toString())
+      .report();
+
+  final options =
+      SentryOptions(dsn: 'https://abc@def.ingest.sentry.io/1234567')
+        ..tracesSampleRate = 1.0;
+  final hub = Hub(options);
+
+  // Span creation throughput: each iteration starts a transaction with
+  // [_spansPerTransaction] children, which is what auto-instrumentation of
+  // DB or HTTP calls typically produces.
+  syncBenchmark('Start transaction with $_spansPerTransaction children', () {
+    final tracer = hub.startTransaction('bench', 'bench.op');
+    for (var i = 0; i < _spansPerTransaction; i++) {
+      tracer.startChild('db.sql.query');
+    }
+  }).report();
+}
@@ -49,6 +49,45 @@ Future<void> execute() async {
 
     image.dispose();
   });
+
+  await benchmarkWidgets((WidgetTester tester) async {
+    await tester.pumpWidget(
+      SentryScreenshotWidget(
+        child: widgets.Directionality(
+          textDirection: TextDirection.ltr,
+          child: widgets.Column(
+            children: List.generate(
+              50,
+              (i) => widgets.RepaintBoundary(
+                child: widgets.Row(
+                  children: List.generate(20, (j) => widgets.Text('$i:$j')),
+                ),
+              ),
+            ),
+          ),
+        ),
+      ),
+    );
+
+    final context = sentryScreenshotWidgetGlobalKey.currentContext!;
+    final root = context.findRenderObject() as RenderRepaintBoundary;
+    final maskingConfig = (SentryPrivacyOptions()..maskAllText = true)
+        // ignore: invalid_use_of_internal_member
+        .buildMaskingConfig(RuntimeChecker());
+    const colorScheme = WidgetFilterColorScheme(
+        defaultMask: Color(0xff000000),
+        defaultTextMask: Color(0xff000000),
+        background: Color(0xffffffff));
+
+    for (final cacheMasks in [false, true]) {
+      final filter = WidgetFilter(maskingConfig, cacheMasks: cacheMasks);
+      syncBenchmark(
+          'WidgetFilter.obscure(${cacheMasks ? 'cached' : 'full'}) x 1000 texts',
+          () {
+        filter.obscure(root: root, context: context, colorScheme: colorScheme);
+      }).report();
+    }
+  });
 }
 
 class PictureToImageBenchmark extends AsyncBenchmark {
@@ -0,0 +1,58 @@
+import 'package:benchmarking/benchmarking.dart';
+import 'package:flutter/widgets.dart';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:sentry_flutter/sentry_flutter.dart';
+import 'package:sentry_flutter/src/view_hierarchy/sentry_tree_walker.dart';
+
+Future<void> execute() async {
+  await benchmarkWidgets((WidgetTester tester) async {
+    // Roughly 10k elements: each tile adds a handful of elements.
+    await tester.pumpWidget(
+      Directionality(
+        textDirection: TextDirection.ltr,
+        child: SingleChildScrollView(
+          child: Column(
+            children: List.generate(
+              2000,
+              (i) => Padding(
+                padding: const EdgeInsets.all(1),
+                child: Text('Item $i', key: ValueKey(i)),
+              ),
+            ),
+          ),
+        ),
+      ),
+    );
+
+    final binding = WidgetsBinding.instance;
+    final options = SentryFlutterOptions();
+    print('Elements: ${_countElements(binding)}');
+
+    syncBenchmark('walkWidgetTree()', () {
+      walkWidgetTree(binding, options);
+    }).report();
+
+    final budgeted = SentryFlutterOptions()
+      ..viewHierarchyFrameBudget = const Duration(milliseconds: 4);
+    (await asyncBenchmark('walkWidgetTreeIncrementally(4ms)', () async {
+      await walkWidgetTreeIncrementally(binding, budgeted);
+    }))
+        .report();
+
+    final capped = SentryFlutterOptions()..viewHierarchyMaxNodes = 1000;
+    syncBenchmark('walkWidgetTree(maxNodes: 1000)', () {
+      walkWidgetTree(binding, capped);
+    }).report();
+  });
+}
+
+int _countElements(WidgetsBinding binding) {
+  var count = 0;
+  void visit(Element element) {
+    count++;
+    element.visitChildElements(visit);
+  }
+
+  binding.rootElement?.visitChildElements(visit);
+  return count;
+}
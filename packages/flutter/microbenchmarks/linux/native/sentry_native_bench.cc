@@ -0,0 +1,347 @@
+// Benchmarks the sentry-native calls that SentryNative
+// (lib/src/native/c/sentry_native.dart) issues through FFI, without the Dart
+// side, so the native cost can be told apart from the FFI and marshalling
+// cost measured by the Dart microbenchmarks.
+//
+// Usage: sentry_native_bench [--json=<path>] [--duration=<ms>] [--filter=<s>]
+
+#include <sentry.h>
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+  std::string name;
+  int threads;
+  // Average time a single thread spends per operation.
+  double micros_per_op;
+  uint64_t iterations;
+};
+
+struct Config {
+  std::chrono::milliseconds duration{1000};
+  std::string filter;
+  std::string json_path;
+};
+
+// Runs `op` for `duration` and returns the number of iterations. The clock is
+// only checked after batches of operations, fast operations would otherwise
+// mostly measure the clock.
+template <typename Op>
+uint64_t RunFor(Op& op, Clock::duration duration, Clock::duration* elapsed) {
+  const auto start = Clock::now();
+  const auto deadline = start + duration;
+  uint64_t iterations = 0;
+  uint64_t batch = 1;
+  auto now = start;
+  while (now < deadline) {
+    for (uint64_t i = 0; i < batch; i++) {
+      op();
+    }
+    iterations += batch;
+    if (batch < 1024) {
+      batch *= 2;
+    }
+    now = Clock::now();
+  }
+  *elapsed = now - start;
+  return iterations;
+}
+
+template <typename Op>
+Result Measure(const Config& config, const char* name, Op op) {
+  Clock::duration elapsed;
+  // Warm up caches and sentry-native's lazily initialized state.
+  RunFor(op, config.duration / 5, &elapsed);
+  const uint64_t iterations = RunFor(op, config.duration, &elapsed);
+  const double micros =
+      std::chrono::duration<double, std::micro>(elapsed).count();
+  return Result{name, 1, micros / iterations, iterations};
+}
+
+// Runs `op` on `threads` threads at the same time. With a single lock behind
+// `op`, the time per operation grows with the number of threads.
+template <typename Op>
+Result MeasureContended(const Config& config,
+                        const char* name,
+                        int threads,
+                        Op op) {
+  std::atomic<int> ready{0};
+  std::atomic<bool> go{false};
+  std::atomic<uint64_t> total_iterations{0};
+  std::vector<Clock::duration> elapsed(threads);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&, t] {
+      Op thread_op = op;
+      ready++;
+      while (!go.load()) {
+        std::this_thread::yield();
+      }
+      Clock::duration warm_up;
+      RunFor(thread_op, config.duration / 5, &warm_up);
+      total_iterations += RunFor(thread_op, config.duration, &elapsed[t]);
+    });
+  }
+  while (ready.load() < threads) {
+    std::this_thread::yield();
+  }
+  go = true;
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  double total_micros = 0;
+  for (const auto& e : elapsed) {
+    total_micros += std::chrono::duration<double, std::micro>(e).count();
+  }
+  const uint64_t iterations = total_iterations.load();
+  return Result{name, threads, total_micros / iterations, iterations};
+}
+
+// Same shape as Breadcrumb.toJson() for an http breadcrumb, converted like
+// `Map<String, dynamic>.toNativeValue()` does.
+sentry_value_t NewBreadcrumb() {
+  sentry_value_t data = sentry_value_new_object();
+  sentry_value_set_by_key(
+      data, "url", sentry_value_new_string("https://example.com/api/items"));
+  sentry_value_set_by_key(data, "method", sentry_value_new_string("GET"));
+  sentry_value_set_by_key(data, "status_code", sentry_value_new_int32(200));
+
+  sentry_value_t breadcrumb = sentry_value_new_object();
+  sentry_value_set_by_key(breadcrumb, "timestamp",
+                          sentry_value_new_string("2024-01-01T00:00:00.000Z"));
+  sentry_value_set_by_key(breadcrumb, "category",
+                          sentry_value_new_string("http"));
+  sentry_value_set_by_key(breadcrumb, "type", sentry_value_new_string("http"));
+  sentry_value_set_by_key(breadcrumb, "level", sentry_value_new_string("info"));
+  sentry_value_set_by_key(breadcrumb, "data", data);
+  return breadcrumb;
+}
+
+// Same shape as the device context that is synced to the native scope.
+sentry_value_t NewContext() {
+  sentry_value_t context = sentry_value_new_object();
+  sentry_value_set_by_key(context, "name", sentry_value_new_string("Linux"));
+  sentry_value_set_by_key(context, "model", sentry_value_new_string("x86_64"));
+  sentry_value_set_by_key(context, "online", sentry_value_new_bool(1));
+  sentry_value_set_by_key(context, "memory_size",
+                          sentry_value_new_int64(17179869184));
+  sentry_value_set_by_key(context, "screen_density",
+                          sentry_value_new_double(1.5));
+  return context;
+}
+
+sentry_value_t NewUser() {
+  sentry_value_t user = sentry_value_new_object();
+  sentry_value_set_by_key(user, "id", sentry_value_new_string("42"));
+  sentry_value_set_by_key(user, "email",
+                          sentry_value_new_string("jane@example.com"));
+  sentry_value_set_by_key(user, "ip_address",
+                          sentry_value_new_string("{{auto}}"));
+  return user;
+}
+
+// Reads a value like `castPrimitive()` does.
+void ReadPrimitive(sentry_value_t value, volatile uint64_t* sink) {
+  if (sentry_value_is_null(value)) {
+    return;
+  }
+  switch (sentry_value_get_type(value)) {
+    case SENTRY_VALUE_TYPE_STRING:
+      *sink += strlen(sentry_value_as_string(value));
+      break;
+    case SENTRY_VALUE_TYPE_INT32:
+      *sink += sentry_value_as_int32(value);
+      break;
+    case SENTRY_VALUE_TYPE_INT64:
+      *sink += sentry_value_as_int64(value);
+      break;
+    case SENTRY_VALUE_TYPE_UINT64:
+      *sink += sentry_value_as_uint64(value);
+      break;
+    default:
+      break;
+  }
+}
+
+// Same calls as SentryNative.loadDebugImages().
+void LoadDebugImages(volatile uint64_t* sink) {
+  static const char* const kKeys[] = {"type",      "image_addr", "image_size",
+                                      "code_file", "debug_id",   "debug_file",
+                                      "code_id"};
+  sentry_value_t images = sentry_get_modules_list();
+  if (sentry_value_get_type(images) == SENTRY_VALUE_TYPE_LIST) {
+    const size_t length = sentry_value_get_length(images);
+    for (size_t i = 0; i < length; i++) {
+      sentry_value_t image = sentry_value_get_by_index(images, i);
+      for (const char* key : kKeys) {
+        ReadPrimitive(sentry_value_get_by_key(image, key), sink);
+      }
+    }
+  }
+  sentry_value_decref(images);
+}
+
+bool ParseArgs(int argc, char** argv, Config* config) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg.rfind("--json=", 0) == 0) {
+      config->json_path = arg.substr(strlen("--json="));
+    } else if (arg.rfind("--duration=", 0) == 0) {
+      config->duration = std::chrono::milliseconds(
+          atoi(arg.substr(strlen("--duration=")).c_str()));
+    } else if (arg.rfind("--filter=", 0) == 0) {
+      config->filter = arg.substr(strlen("--filter="));
+    } else {
+      fprintf(stderr, "Unknown argument: %s\n", arg.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+// Writes the results in the format of the `dart` package benchmarks
+// (packages/dart/benchmark), so both can be compared with the same tooling.
+bool WriteJson(const std::string& path, const std::vector<Result>& results) {
+  FILE* file = fopen(path.c_str(), "w");
+  if (file == nullptr) {
+    perror(path.c_str());
+    return false;
+  }
+  fprintf(file, "{\n  \"sentry_native\": \"%s\",\n  \"os\": \"linux\",\n",
+          sentry_sdk_version());
+  fprintf(file, "  \"benchmarks\": {");
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result& result = results[i];
+    fprintf(file,
+            "%s\n    \"%s\": {\n      \"us_per_op\": %.4f,\n"
+            "      \"iterations\": %llu,\n      \"threads\": %d\n    }",
+            i == 0 ? "" : ",", result.name.c_str(), result.micros_per_op,
+            static_cast<unsigned long long>(result.iterations),
+            result.threads);
+  }
+  fprintf(file, "\n  }\n}\n");
+  return fclose(file) == 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Config config;
+  if (!ParseArgs(argc, argv, &config)) {
+    return 64;
+  }
+
+  char database_path[] = "/tmp/sentry-native-bench-XXXXXX";
+  if (mkdtemp(database_path) == nullptr) {
+    perror("mkdtemp");
+    return 1;
+  }
+
+  // Same options as SentryNative.createOptions(), without a DSN so nothing
+  // is sent.
+  sentry_options_t* options = sentry_options_new();
+  sentry_options_set_database_path(options, database_path);
+  sentry_options_set_auto_session_tracking(options, 0);
+  sentry_options_set_max_breadcrumbs(options, 100);
+#ifdef SENTRY_BENCH_HANDLER_PATH
+  sentry_options_set_handler_path(options, SENTRY_BENCH_HANDLER_PATH);
+#endif
+  if (sentry_init(options) != 0) {
+    fprintf(stderr, "sentry_init() failed\n");
+    return 1;
+  }
+
+  volatile uint64_t sink = 0;
+  std::vector<Result> results;
+  auto add = [&](const char* name, const std::function<Result()>& bench) {
+    if (!config.filter.empty() &&
+        std::string(name).find(config.filter) == std::string::npos) {
+      return;
+    }
+    const Result result = bench();
+    printf("%s: %.4fus/op (%llu iterations, %d threads)\n", name,
+           result.micros_per_op,
+           static_cast<unsigned long long>(result.iterations), result.threads);
+    results.push_back(result);
+  };
+
+  add("sentry_value_t breadcrumb", [&] {
+    return Measure(config, "sentry_value_t breadcrumb",
+                   [] { sentry_value_decref(NewBreadcrumb()); });
+  });
+  add("sentry_add_breadcrumb", [&] {
+    return Measure(config, "sentry_add_breadcrumb",
+                   [] { sentry_add_breadcrumb(NewBreadcrumb()); });
+  });
+  add("sentry_set_tag", [&] {
+    return Measure(config, "sentry_set_tag",
+                   [] { sentry_set_tag("environment", "production"); });
+  });
+  add("sentry_remove_tag", [&] {
+    return Measure(config, "sentry_remove_tag",
+                   [] { sentry_remove_tag("environment"); });
+  });
+  add("sentry_set_extra", [&] {
+    return Measure(config, "sentry_set_extra", [] {
+      sentry_set_extra("build", sentry_value_new_string("1234"));
+    });
+  });
+  add("sentry_set_context", [&] {
+    return Measure(config, "sentry_set_context",
+                   [] { sentry_set_context("device", NewContext()); });
+  });
+  add("sentry_set_user", [&] {
+    return Measure(config, "sentry_set_user",
+                   [] { sentry_set_user(NewUser()); });
+  });
+  add("sentry_get_modules_list", [&] {
+    return Measure(config, "sentry_get_modules_list",
+                   [&sink] { LoadDebugImages(&sink); });
+  });
+
+  // The scope setters all take sentry-native's scope lock, so these show how
+  // scope syncs from several isolates or threads contend with each other.
+  for (int threads : {2, 4, 8}) {
+    const std::string name =
+        "sentry_add_breadcrumb x" + std::to_string(threads) + " threads";
+    add(name.c_str(), [&] {
+      return MeasureContended(config, name.c_str(), threads,
+                              [] { sentry_add_breadcrumb(NewBreadcrumb()); });
+    });
+  }
+  for (int threads : {2, 4, 8}) {
+    const std::string name =
+        "sentry_set_tag x" + std::to_string(threads) + " threads";
+    add(name.c_str(), [&] {
+      return MeasureContended(config, name.c_str(), threads, [] {
+        sentry_set_tag("environment", "production");
+      });
+    });
+  }
+  add("sentry_get_modules_list x4 threads", [&] {
+    return MeasureContended(config, "sentry_get_modules_list x4 threads", 4,
+                            [&sink] { LoadDebugImages(&sink); });
+  });
+
+  sentry_close();
+
+  if (!config.json_path.empty() && !WriteJson(config.json_path, results)) {
+    return 1;
+  }
+  return 0;
+}
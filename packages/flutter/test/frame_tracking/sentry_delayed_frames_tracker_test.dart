@@ -32,6 +32,15 @@ void main() {
       );
     });
 
+    test('stops collecting one frame past maxDelayedFramesBuffer', () {
+      for (int i = 0; i < maxDelayedFramesBuffer + 100; i++) {
+        sut.addDelayedFrame(DateTime.fromMillisecondsSinceEpoch(0 + i),
+            DateTime.fromMillisecondsSinceEpoch(50 + i));
+      }
+
+      expect(sut.delayedFrames.length, maxDelayedFramesBuffer + 1);
+    });
+
     test('captures slow frames', () {
       sut.addDelayedFrame(DateTime.fromMillisecondsSinceEpoch(0),
           DateTime.fromMillisecondsSinceEpoch(50));
@@ -178,6 +187,52 @@ void main() {
       expect(metrics.framesDelay, 0.784); // 800ms - 16ms = 784ms delay
     });
 
+    test('calculates metrics for a span within many frames', () {
+      // 100 slow frames of 20ms followed by 10 frozen frames of 800ms,
+      // one frame every second.
+      for (var i = 0; i < 110; i++) {
+        final start = DateTime.fromMillisecondsSinceEpoch(i * 1000);
+        final duration = i < 100 ? 20 : 800;
+        sut.addDelayedFrame(
+            start, start.add(Duration(milliseconds: duration)));
+      }
+
+      // Covers slow frames 95..99 and frozen frames 100..104.
+      final metrics = sut.getFrameMetrics(
+        spanStartTimestamp: DateTime.fromMillisecondsSinceEpoch(95000),
+        spanEndTimestamp: DateTime.fromMillisecondsSinceEpoch(105000),
+      );
+
+      expect(metrics, isNotNull);
+      expect(metrics!.slowFrameCount, 5);
+      expect(metrics.frozenFrameCount, 5);
+      expect(metrics.framesDelay, (5 * 4 + 5 * 784) / 1000);
+    });
+
+    test('keeps metrics correct after removing frames and wrapping around',
+        () {
+      for (var i = 0; i < 60; i++) {
+        final start = DateTime.fromMillisecondsSinceEpoch(i * 100);
+        sut.addDelayedFrame(start, start.add(Duration(milliseconds: 20)));
+      }
+      sut.removeIrrelevantFrames(DateTime.fromMillisecondsSinceEpoch(5000));
+      expect(sut.delayedFrames.length, 10);
+
+      for (var i = 60; i < 120; i++) {
+        final start = DateTime.fromMillisecondsSinceEpoch(i * 100);
+        sut.addDelayedFrame(start, start.add(Duration(milliseconds: 20)));
+      }
+
+      final metrics = sut.getFrameMetrics(
+        spanStartTimestamp: DateTime.fromMillisecondsSinceEpoch(5000),
+        spanEndTimestamp: DateTime.fromMillisecondsSinceEpoch(12000),
+      );
+
+      expect(sut.delayedFrames.length, 70);
+      expect(metrics!.slowFrameCount, 70);
+      expect(metrics.framesDelay, 70 * 4 / 1000);
+    });
+
     test('removeIrrelevantFrames removes the correct frames', () {
       sut.addDelayedFrame(DateTime.fromMillisecondsSinceEpoch(20),
           DateTime.fromMillisecondsSinceEpoch(50));
@@ -27,6 +27,21 @@ void main() {
     sut.free();
   });
 
+  test('view with an offset', () async {
+    final view = ByteData.sublistView(testSrcList, 2, 6);
+    final sut = NativeMemory.fromByteData(view);
+    expect(sut.length, 4);
+    expect(sut.asTypedList(), [3, 4, 5, 6]);
+    sut.free();
+  });
+
+  test('large buffer', () async {
+    final src = Uint8List.fromList(List.generate(4099, (i) => i % 251));
+    final sut = NativeMemory.fromByteData(src.buffer.asByteData());
+    expect(sut.asTypedList(), src);
+    sut.free();
+  });
+
   test('json', () async {
     final sut = NativeMemory.fromByteData(testSrcData);
     final json = sut.toJson();
@@ -10,7 +10,9 @@ class NativeMemory {
   const NativeMemory._(this.pointer, this.length);
 
   factory NativeMemory.fromByteData(ByteData source) {
-    return NativeMemory._(Pointer<Uint8>._store(source.buffer.asUint8List()),
+    return NativeMemory._(
+        Pointer<Uint8>._store(Uint8List.fromList(source.buffer
+            .asUint8List(source.offsetInBytes, source.lengthInBytes))),
         source.lengthInBytes);
   }
 
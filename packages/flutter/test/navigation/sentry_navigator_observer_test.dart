@@ -669,6 +669,22 @@ void main() {
       );
     });
 
+    test('dispatches OnNavigation', () {
+      final hub = _MockHub();
+      _whenAnyStart(hub, NoOpSentrySpan());
+      final observer = fixture.getSut(hub: hub);
+      final events = <OnNavigation>[];
+      hub.options.lifecycleRegistry.registerCallback<OnNavigation>(events.add);
+
+      observer.didPush(
+        route(routeSettings('to')),
+        route(routeSettings('previous')),
+      );
+
+      expect(events.single.from, 'previous');
+      expect(events.single.to, 'to');
+    });
+
     test('No arguments', () {
       final hub = _MockHub();
       _whenAnyStart(hub, NoOpSentrySpan());
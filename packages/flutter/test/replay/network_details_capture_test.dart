@@ -225,11 +225,38 @@ void main() {
           },
         );
 
-        final (forwardedResponse, data) = await sut.captureResponse(response);
+        final (forwardedResponse, data, captured) =
+            await sut.captureResponse(response);
 
         expect(data['headers'], {'content-type': 'application/json'});
-        expect(data['body'], 'partial-body');
+        expect(data.containsKey('body'), false);
         expect(await forwardedResponse.stream.bytesToString(), 'partial-body');
+        await captured;
+        expect(data['body'], 'partial-body');
+        expect(data.containsKey('_meta'), false);
+      });
+
+      test('forwards the original chunks without copying them', () async {
+        final fixture = Fixture();
+        fixture.options.sendDefaultPii = true;
+        final sut = fixture.getSut();
+
+        final chunks = [
+          for (var i = 0; i < 10; i++) '{"chunk":$i}'.codeUnits,
+        ];
+        final response = StreamedResponse(
+          Stream.fromIterable(chunks),
+          200,
+          headers: {'content-type': 'application/json'},
+        );
+
+        final (forwardedResponse, _, _) = await sut.captureResponse(response);
+        final forwarded = await forwardedResponse.stream.toList();
+
+        expect(forwarded, hasLength(chunks.length));
+        for (var i = 0; i < chunks.length; i++) {
+          expect(forwarded[i], same(chunks[i]));
+        }
       });
 
       test('does not capture body for non-capturable content type', () async {
@@ -243,8 +270,10 @@ void main() {
           headers: {'content-type': 'application/octet-stream'},
         );
 
-        final (forwardedResponse, data) = await sut.captureResponse(response);
+        final (forwardedResponse, data, captured) =
+            await sut.captureResponse(response);
 
+        expect(captured, isNull);
         expect(data.containsKey('body'), false);
         expect(await forwardedResponse.stream.bytesToString(), 'binary');
       });
@@ -260,8 +289,10 @@ void main() {
           headers: {'content-type': 'application/json'},
         );
 
-        final (forwardedResponse, data) = await sut.captureResponse(response);
+        final (forwardedResponse, data, captured) =
+            await sut.captureResponse(response);
 
+        expect(captured, isNull);
         expect(data.containsKey('body'), false);
         expect(await forwardedResponse.stream.bytesToString(), '{"foo":"bar"}');
       });
@@ -279,8 +310,10 @@ void main() {
           headers: {'content-type': 'application/json'},
         );
 
-        final (forwardedResponse, data) = await sut.captureResponse(response);
+        final (forwardedResponse, data, captured) =
+            await sut.captureResponse(response);
 
+        expect(captured, isNull);
         expect(data.containsKey('body'), false);
         expect(await forwardedResponse.stream.bytesToString(), '{"foo":"bar"}');
       });
@@ -312,15 +345,66 @@ void main() {
           headers: {'content-type': 'text/plain'},
         );
 
-        final (forwardedResponse, data) = await sut.captureResponse(response);
+        final (forwardedResponse, data, captured) =
+            await sut.captureResponse(response);
 
+        expect(await forwardedResponse.stream.bytesToString(), oversizedBody);
+        await captured;
         // 150KB, pinned as a literal rather than maxBodySize so this can't
         // pass by construction if the constant itself were wrong.
         expect((data['body'] as String).length, 150 * 1024);
-        expect(await forwardedResponse.stream.bytesToString(), oversizedBody);
+        expect(data['_meta'], {
+          'warnings': ['TEXT_TRUNCATED'],
+        });
+      });
+
+      test('marks the body as truncated when the caller stops reading it',
+          () async {
+        final fixture = Fixture();
+        fixture.options.sendDefaultPii = true;
+        final sut = fixture.getSut();
+
+        final response = StreamedResponse(
+          Stream.fromIterable(['{"a":'.codeUnits, '1}'.codeUnits]),
+          200,
+          headers: {'content-type': 'application/json'},
+        );
+
+        final (forwardedResponse, data, captured) =
+            await sut.captureResponse(response);
+
+        await forwardedResponse.stream.first;
+        await captured;
+        expect(data['body'], '{"a":');
+        expect(data['_meta'], {
+          'warnings': ['MAYBE_JSON_TRUNCATED'],
+        });
       });
 
-      test('rethrows when the response body fails to read', () async {
+      test('completes without a body when the caller does not read it',
+          () async {
+        final fixture = Fixture();
+        fixture.options.sendDefaultPii = true;
+        final sut = fixture.getSut();
+
+        final response = StreamedResponse(
+          Stream.value('{"a":1}'.codeUnits),
+          200,
+          headers: {'content-type': 'application/json'},
+        );
+
+        final (forwardedResponse, data, captured) =
+            await sut.captureResponse(response);
+        await captured;
+
+        expect(data.containsKey('body'), false);
+        // Reading the body later still forwards it.
+        expect(await forwardedResponse.stream.bytesToString(), '{"a":1}');
+        expect(data.containsKey('body'), false);
+      });
+
+      test('forwards the error and drops the body when it fails to read',
+          () async {
         final fixture = Fixture();
         fixture.options.sendDefaultPii = true;
         final sut = fixture.getSut();
@@ -332,12 +416,17 @@ void main() {
           headers: {'content-type': 'application/json'},
         );
 
+        final (forwardedResponse, data, captured) =
+            await sut.captureResponse(response);
+
         try {
-          await sut.captureResponse(response);
+          await forwardedResponse.stream.toBytes();
           fail('Method did not throw');
         } on Exception catch (e) {
           expect(e, same(readError));
         }
+        await captured;
+        expect(data.containsKey('body'), false);
       });
     });
   });
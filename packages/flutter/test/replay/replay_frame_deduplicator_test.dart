@@ -0,0 +1,76 @@
+@TestOn('vm')
+library;
+
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:sentry_flutter/src/replay/replay_frame_deduplicator.dart';
+
+void main() {
+  late ReplayFrameDeduplicator sut;
+
+  setUp(() {
+    sut = ReplayFrameDeduplicator(maxSkippedDuration: Duration(seconds: 2));
+  });
+
+  Uint8List frame(int value) => Uint8List(2 * 2 * 4)..fillRange(0, 16, value);
+
+  /// Submits the frame if it needs to be, like the replay recorder.
+  bool submit(Uint8List frame, int width, int height, int timestamp) {
+    final submit = sut.shouldSubmit(frame, width, height, timestamp);
+    if (submit) {
+      sut.submitted(frame, width, height, timestamp);
+    }
+    return submit;
+  }
+
+  test('submits the first frame', () {
+    expect(submit(frame(1), 2, 2, 0), isTrue);
+  });
+
+  test('skips identical frames', () {
+    expect(submit(frame(1), 2, 2, 0), isTrue);
+    expect(submit(frame(1), 2, 2, 1000), isFalse);
+  });
+
+  test('submits changed frames', () {
+    expect(submit(frame(1), 2, 2, 0), isTrue);
+    expect(submit(frame(2), 2, 2, 1000), isTrue);
+    expect(submit(frame(1), 2, 2, 1500), isTrue);
+  });
+
+  test('submits frames with a different size', () {
+    expect(submit(frame(1), 2, 2, 0), isTrue);
+    expect(submit(frame(1), 4, 1, 1000), isTrue);
+  });
+
+  test('submits identical frames after the max skipped duration', () {
+    expect(submit(frame(1), 2, 2, 0), isTrue);
+    expect(submit(frame(1), 2, 2, 1000), isFalse);
+    expect(submit(frame(1), 2, 2, 2000), isTrue);
+    expect(submit(frame(1), 2, 2, 3000), isFalse);
+  });
+
+  test('submits a frame again if it was not submitted', () {
+    expect(sut.shouldSubmit(frame(1), 2, 2, 0), isTrue);
+    expect(sut.shouldSubmit(frame(1), 2, 2, 1000), isTrue);
+  });
+
+  test('compares only the bytes of the frame views', () {
+    final buffer = Uint8List(40)..fillRange(0, 40, 7);
+    final a = Uint8List.sublistView(buffer, 1, 17);
+    final b = Uint8List.sublistView(Uint8List(17)..fillRange(1, 17, 7), 1);
+
+    expect(submit(a, 2, 2, 0), isTrue);
+    expect(submit(b, 2, 2, 1000), isFalse);
+
+    buffer[17] = 0;
+    expect(submit(a, 2, 2, 1500), isFalse);
+  });
+
+  test('submits after reset', () {
+    expect(submit(frame(1), 2, 2, 0), isTrue);
+    sut.reset();
+    expect(submit(frame(1), 2, 2, 1000), isTrue);
+  });
+}
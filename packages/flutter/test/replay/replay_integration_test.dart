@@ -111,6 +111,35 @@ void main() {
     expect(config.height, 480);
   });
 
+  testWidgets('Lowers resolution under memory pressure', (tester) async {
+    options.replay.sessionSampleRate = 1.0;
+    when(native.setReplayConfig(any)).thenReturn(null);
+    sut.call(hub, options);
+
+    TestWidgetsFlutterBinding.ensureInitialized();
+    await pumpTestElement(tester);
+    await tester.pumpAndSettle(Duration(seconds: 1));
+
+    await options.lifecycleRegistry.dispatchCallback(
+      OnMemoryPressure(MemoryPressureLevel.high, MemoryPressureLevel.moderate),
+    );
+    await options.lifecycleRegistry.dispatchCallback(
+      OnMemoryPressure(MemoryPressureLevel.critical, MemoryPressureLevel.high),
+    );
+    await options.lifecycleRegistry.dispatchCallback(
+      OnMemoryPressure(MemoryPressureLevel.moderate, MemoryPressureLevel.high),
+    );
+
+    final configs = verify(native.setReplayConfig(captureAny))
+        .captured
+        .cast<ReplayConfig>();
+    expect(configs.map((config) => (config.width, config.height)), [
+      (800, 600),
+      (640, 480),
+      (800, 600),
+    ]);
+  });
+
   testWidgets(
       'Does not call setReplayConfig again when widget size remains unchanged',
       (tester) async {
@@ -1,3 +1,5 @@
+// ignore_for_file: invalid_use_of_internal_member
+
 // For some reason, this test is not working in the browser but that's OK, we
 // don't support video recording anyway.
 @TestOn('vm')
@@ -6,6 +8,7 @@ library;
 import 'dart:async';
 
 import 'package:flutter_test/flutter_test.dart';
+import 'package:sentry_flutter/sentry_flutter.dart';
 import 'package:sentry_flutter/src/replay/scheduled_recorder.dart';
 import 'package:sentry_flutter/src/replay/scheduled_recorder_config.dart';
 
@@ -30,19 +33,69 @@ void main() async {
       expect(fixture.capturedImages, ['1000x750', '1000x750']);
     });
   });
+
+  testWidgets('backs off while the screen does not change', (tester) async {
+    await tester.runAsync(() async {
+      final fixture = await _Fixture.create(tester, adaptiveFrameRate: true);
+      const initialInterval = Duration(milliseconds: 1);
+      expect(fixture.sut.captureInterval, initialInterval);
+
+      await fixture.nextFrame(true);
+      await fixture.nextFrame(true);
+      expect(fixture.sut.captureInterval, greaterThan(initialInterval));
+
+      await fixture.options.lifecycleRegistry
+          .dispatchCallback(OnNavigation(from: '/', to: '/next'));
+      expect(fixture.sut.captureInterval, initialInterval);
+
+      await fixture.sut.stop();
+      expect(
+        fixture.options.lifecycleRegistry.lifecycleCallbacks[OnNavigation],
+        isEmpty,
+      );
+    });
+  });
+
+  testWidgets('clears its caches when the memory pressure rises',
+      (tester) async {
+    await tester.runAsync(() async {
+      final fixture = await _Fixture.create(tester);
+      final callbacks = fixture.options.lifecycleRegistry.lifecycleCallbacks;
+      expect(callbacks[OnMemoryPressure], hasLength(1));
+
+      await fixture.sut.start();
+      expect(callbacks[OnMemoryPressure], hasLength(1));
+
+      await fixture.options.lifecycleRegistry.dispatchCallback(
+        OnMemoryPressure(
+          MemoryPressureLevel.moderate,
+          MemoryPressureLevel.normal,
+        ),
+      );
+      await fixture.nextFrame(true);
+      expect(fixture.capturedImages, ['1000x750']);
+
+      await fixture.sut.stop();
+      expect(callbacks[OnMemoryPressure], isEmpty);
+    });
+  });
 }
 
 class _Fixture {
   final WidgetTester _tester;
+  final SentryFlutterOptions options;
   late final ScheduledScreenshotRecorder _sut;
   final capturedImages = <String>[];
   late Completer<void> _completer;
 
   ScheduledScreenshotRecorder get sut => _sut;
 
-  _Fixture._(this._tester) {
+  _Fixture._(this._tester, {bool adaptiveFrameRate = false})
+      : options = defaultTestOptions()
+          ..bindingUtils = TestBindingWrapper()
+          ..replay.adaptiveFrameRate = adaptiveFrameRate {
     _sut = ScheduledScreenshotRecorder(
-      defaultTestOptions()..bindingUtils = TestBindingWrapper(),
+      options,
       (image, isNewlyCaptured) async {
         capturedImages.add('${image.width}x${image.height}');
         _completer.complete();
@@ -56,8 +109,9 @@ class _Fixture {
     ));
   }
 
-  static Future<_Fixture> create(WidgetTester tester) async {
-    final fixture = _Fixture._(tester);
+  static Future<_Fixture> create(WidgetTester tester,
+      {bool adaptiveFrameRate = false}) async {
+    final fixture = _Fixture._(tester, adaptiveFrameRate: adaptiveFrameRate);
     await pumpTestElement(tester);
     await fixture.sut.start();
     return fixture;
@@ -71,6 +71,48 @@ void main() {
     await fixture.drawFrame();
     expect(fixture.calls, 2);
   });
+
+  test('backs off up to the max interval', () {
+    var fixture = _Fixture(null, const Duration(milliseconds: 4));
+
+    expect(fixture.sut.interval, const Duration(milliseconds: 1));
+    fixture.sut.backOff();
+    expect(fixture.sut.interval, const Duration(milliseconds: 2));
+    fixture.sut.backOff();
+    fixture.sut.backOff();
+    expect(fixture.sut.interval, const Duration(milliseconds: 4));
+  });
+
+  test('does not back off without a max interval', () {
+    var fixture = _Fixture();
+
+    fixture.sut.backOff();
+    expect(fixture.sut.interval, const Duration(milliseconds: 1));
+  });
+
+  test('wakeUp restores the interval and runs after the next frame',
+      () async {
+    var fixture = _Fixture(null, const Duration(seconds: 10));
+    fixture.sut.start();
+    await fixture.drawFrame();
+    expect(fixture.calls, 1);
+
+    for (var i = 0; i < 10; i++) {
+      fixture.sut.backOff();
+    }
+    await fixture.drawFrame();
+    expect(fixture.calls, 2);
+
+    // The next run is now about a second away.
+    await fixture.drawFrame(awaitCallback: false);
+    expect(fixture.calls, 2);
+
+    fixture.sut.wakeUp();
+    expect(fixture.sut.interval, const Duration(milliseconds: 1));
+    await fixture.drawFrame();
+    expect(fixture.calls, 3);
+    await fixture.sut.stop();
+  });
 }
 
 class _Fixture {
@@ -79,7 +121,7 @@ class _Fixture {
   var registeredCallback = Completer<FrameCallback>();
   var _frames = 0;
 
-  _Fixture([SchedulerCallback? callback]) {
+  _Fixture([SchedulerCallback? callback, Duration? maxInterval]) {
     sut = Scheduler(
       const Duration(milliseconds: 1),
       (timestamp) async {
@@ -87,6 +129,7 @@ class _Fixture {
         await callback?.call(timestamp);
       },
       _addPostFrameCallbackMock,
+      maxInterval: maxInterval,
     );
   }
 
@@ -217,6 +217,55 @@ void main() async {
       dataB.setInt8(dataB.lengthInBytes >> 2, 0);
       expect(Screenshot.listEquals(dataA, dataB), isFalse);
     });
+
+    test('listEquals() compares only the bytes of the views', () {
+      final buffer = Uint8List(40)..fillRange(0, 40, 1);
+      final other = Uint8List(40)..fillRange(0, 40, 1);
+      other[0] = 0;
+      other[30] = 0;
+
+      // Aligned to 8 bytes and not.
+      expect(
+        Screenshot.listEquals(
+          ByteData.sublistView(buffer, 8, 24),
+          ByteData.sublistView(other, 8, 24),
+        ),
+        isTrue,
+      );
+      expect(
+        Screenshot.listEquals(
+          ByteData.sublistView(buffer, 3, 29),
+          ByteData.sublistView(other, 1, 27),
+        ),
+        isTrue,
+      );
+      expect(
+        Screenshot.listEquals(
+          ByteData.sublistView(buffer, 8, 32),
+          ByteData.sublistView(other, 8, 32),
+        ),
+        isFalse,
+      );
+    });
+
+    test('sampledHash()', () {
+      final dataA = Uint8List.fromList(
+              List.generate(4 * 1000 * 1000, (index) => index % 251))
+          .buffer
+          .asByteData();
+      final dataB = ByteData(dataA.lengthInBytes)
+        ..buffer.asUint8List().setAll(0, dataA.buffer.asUint8List());
+      expect(Screenshot.sampledHash(dataA), Screenshot.sampledHash(dataB));
+
+      dataB.setUint8(0, 255);
+      expect(Screenshot.sampledHash(dataA),
+          isNot(Screenshot.sampledHash(dataB)));
+
+      expect(
+        Screenshot.sampledHash(ByteData(8)),
+        isNot(Screenshot.sampledHash(ByteData(12))),
+      );
+    });
   });
 }
 
@@ -24,6 +24,7 @@ void main() async {
   final createSut = (
       {bool redactImages = false,
       bool redactText = false,
+      bool cacheMasks = false,
       RuntimeChecker? runtimeChecker}) {
     final privacyOptions = SentryPrivacyOptions()
       ..maskAllImages = redactImages
@@ -32,7 +33,7 @@ void main() async {
     logger.captureInternalLogs();
     final maskingConfig =
         privacyOptions.buildMaskingConfig(runtimeChecker ?? RuntimeChecker());
-    return WidgetFilter(maskingConfig);
+    return WidgetFilter(maskingConfig, cacheMasks: cacheMasks);
   };
 
   boundsRect(WidgetFilterItem item) =>
@@ -220,6 +221,104 @@ void main() async {
     expect(boundsRect(sut.items[0]), '344x248');
   });
 
+  group('mask cache', () {
+    void obscure(WidgetFilter sut, Element element) => sut.obscure(
+        context: element,
+        root: element.renderObject as RenderRepaintBoundary,
+        colorScheme: colorScheme);
+
+    List<String> describe(List<WidgetFilterItem> items) => items
+        .map((item) => '${item.color} ${item.bounds}')
+        .toList(growable: false);
+
+    testWidgets('produces the same items as without cache', (tester) async {
+      final sut = createSut(redactText: true, redactImages: true);
+      final cached =
+          createSut(redactText: true, redactImages: true, cacheMasks: true);
+      final element = await pumpTestElement(tester);
+
+      obscure(sut, element);
+      obscure(cached, element);
+      expect(describe(cached.items), describe(sut.items));
+
+      obscure(cached, element);
+      expect(describe(cached.items), describe(sut.items));
+    });
+
+    testWidgets('reuses items if nothing was repainted', (tester) async {
+      final sut = createSut(redactText: true, cacheMasks: true);
+      final element = await pumpTestElement(tester, children: [
+        Text('foo'),
+        Padding(padding: EdgeInsets.all(10), child: Text('bar')),
+      ]);
+
+      obscure(sut, element);
+      final first = List.of(sut.items);
+      await tester.pump();
+      obscure(sut, element);
+
+      expect(sut.items.length, first.length);
+      for (var i = 0; i < first.length; i++) {
+        expect(sut.items[i], same(first[i]));
+      }
+    });
+
+    testWidgets('does not reuse items after clearCache', (tester) async {
+      final sut = createSut(redactText: true, cacheMasks: true);
+      final element = await pumpTestElement(tester, children: [
+        Text('foo'),
+      ]);
+
+      obscure(sut, element);
+      final first = List.of(sut.items);
+      await tester.pump();
+      sut.clearCache();
+      obscure(sut, element);
+
+      expect(describe(sut.items), describe(first));
+      expect(sut.items.first, isNot(same(first.first)));
+    });
+
+    testWidgets('updates items after layout changes', (tester) async {
+      final sut = createSut(redactText: true, cacheMasks: true);
+      var element = await pumpTestElement(tester, children: [
+        Padding(padding: EdgeInsets.all(100), child: Text('foo')),
+      ]);
+      obscure(sut, element);
+      final before = describe(sut.items);
+
+      element = await pumpTestElement(tester, children: [
+        Padding(padding: EdgeInsets.all(10), child: Text('foo')),
+      ]);
+      obscure(sut, element);
+
+      final uncached = createSut(redactText: true);
+      obscure(uncached, element);
+      expect(describe(sut.items), describe(uncached.items));
+      expect(describe(sut.items), isNot(before));
+    });
+
+    testWidgets('updates items of repainted subtrees only', (tester) async {
+      final sut = createSut(redactText: true, cacheMasks: true);
+      Future<Element> pump(String text) => pumpTestElement(tester, children: [
+            RepaintBoundary(child: Text('static')),
+            RepaintBoundary(child: Text(text)),
+          ]);
+      var element = await pump('foo');
+      obscure(sut, element);
+      final first = List.of(sut.items);
+
+      element = await pump('a much longer text');
+      obscure(sut, element);
+
+      final uncached = createSut(redactText: true);
+      obscure(uncached, element);
+      expect(describe(sut.items), describe(uncached.items));
+      expect(sut.items.first, same(first.first));
+      expect(sut.items.last, isNot(same(first.last)));
+    });
+  });
+
   group('warning on sensitive widgets', () {
     assert(MockRuntimeCheckerBuildMode.values.length == 3);
     for (final buildMode in MockRuntimeCheckerBuildMode.values) {
@@ -1,10 +1,12 @@
 import 'dart:convert';
+import 'dart:math';
 
 import 'package:flutter/material.dart';
 import 'package:flutter_test/flutter_test.dart';
 import 'package:sentry/sentry.dart';
 import 'package:sentry_flutter/src/binding_wrapper.dart';
 import 'package:sentry_flutter/src/sentry_flutter_options.dart';
+import 'package:sentry_flutter/src/view_hierarchy/sentry_tree_walker.dart';
 import 'package:sentry_flutter/src/view_hierarchy/view_hierarchy_event_processor.dart';
 
 import '../mocks.dart';
@@ -105,6 +107,124 @@ void main() {
       });
     });
 
+    group('capture limits', () {
+      Future<Map<String, dynamic>> capture(
+          SentryViewHierarchyEventProcessor sut) async {
+        final hint = Hint();
+        await sut.apply(SentryEvent(throwable: StateError('error')), hint);
+        final bytes = await hint.viewHierarchy!.bytes;
+        return jsonDecode(utf8.decode(bytes)) as Map<String, dynamic>;
+      }
+
+      int countNodes(Map<String, dynamic> element) {
+        final children = (element['children'] as List?) ?? [];
+        return children.fold<int>(
+            1, (sum, child) => sum + countNodes(child as Map<String, dynamic>));
+      }
+
+      int maxDepth(Map<String, dynamic> element) {
+        final children = (element['children'] as List?) ?? [];
+        return children.fold<int>(
+            element['depth'] as int,
+            (depth, child) =>
+                max(depth, maxDepth(child as Map<String, dynamic>)));
+      }
+
+      Map<String, dynamic> root(Map<String, dynamic> json) =>
+          (json['windows'] as List).single as Map<String, dynamic>;
+
+      testWidgets('respects max nodes', (tester) async {
+        await tester.runAsync(() async {
+          fixture.options.viewHierarchyMaxNodes = 5;
+          final sut = fixture.getSut(instance);
+          await tester.pumpWidget(MyApp());
+
+          final json = await capture(sut);
+
+          expect(countNodes(root(json)), lessThanOrEqualTo(5));
+        });
+      });
+
+      testWidgets('respects max depth', (tester) async {
+        await tester.runAsync(() async {
+          fixture.options.viewHierarchyMaxDepth = 2;
+          final sut = fixture.getSut(instance);
+          await tester.pumpWidget(MyApp());
+
+          final json = await capture(sut);
+          final rootElement = root(json);
+
+          expect(maxDepth(rootElement),
+              lessThanOrEqualTo((rootElement['depth'] as int) + 2));
+        });
+      });
+
+      testWidgets('incremental capture matches synchronous capture',
+          (tester) async {
+        await tester.runAsync(() async {
+          await tester.pumpWidget(MyApp());
+          final expected = await capture(fixture.getSut(instance));
+
+          fixture.options.viewHierarchyFrameBudget = Duration.zero;
+          final actual = await capture(fixture.getSut(instance));
+
+          expect(actual, expected);
+        });
+      });
+
+      testWidgets('reuses capture if no frame was rendered', (tester) async {
+        await tester.runAsync(() async {
+          // Overrules debouncing of the second capture.
+          fixture.options.beforeCaptureViewHierarchy = (_, __, ___) => true;
+          final sut = fixture.getSut(instance);
+          await tester.pumpWidget(MyApp());
+
+          final firstHint = Hint();
+          await sut.apply(SentryEvent(throwable: StateError('1')), firstHint);
+          final secondHint = Hint();
+          await sut.apply(SentryEvent(throwable: StateError('2')), secondHint);
+
+          expect(fixture.walks, 1);
+          expect(
+            await secondHint.viewHierarchy!.bytes,
+            await firstHint.viewHierarchy!.bytes,
+          );
+        });
+      });
+
+      testWidgets('captures again after a frame was rendered', (tester) async {
+        await tester.runAsync(() async {
+          fixture.options.beforeCaptureViewHierarchy = (_, __, ___) => true;
+          final sut = fixture.getSut(instance);
+          await tester.pumpWidget(MyApp());
+
+          await capture(sut);
+          await tester.pump();
+          await capture(sut);
+
+          expect(fixture.walks, 2);
+        });
+      });
+
+      testWidgets('captures again if the walk options changed',
+          (tester) async {
+        await tester.runAsync(() async {
+          fixture.options.beforeCaptureViewHierarchy = (_, __, ___) => true;
+          final sut = fixture.getSut(instance);
+          await tester.pumpWidget(MyApp());
+
+          await capture(sut);
+          fixture.options.viewHierarchyMaxNodes = 5;
+          final json = await capture(sut);
+          fixture.options.viewHierarchyMaxDepth = 2;
+          await capture(sut);
+
+          expect(fixture.walks, 3);
+          expect(countNodes(root(json)), lessThanOrEqualTo(5));
+        });
+      });
+    });
+
     group('beforeCaptureViewHierarchy', () {
       late SentryEvent event;
       late Hint hint;
@@ -326,13 +446,20 @@ class TestBindingWrapper implements BindingWrapper {
 
 class Fixture {
   SentryFlutterOptions options = defaultTestOptions();
+  var walks = 0;
 
   SentryViewHierarchyEventProcessor getSut(WidgetsBinding instance,
       {bool reportViewHierarchyIdentifiers = true}) {
     options
       ..bindingUtils = TestBindingWrapper(instance)
       ..reportViewHierarchyIdentifiers = reportViewHierarchyIdentifiers;
-    return SentryViewHierarchyEventProcessor(options);
+    return SentryViewHierarchyEventProcessor(
+      options,
+      walker: (instance, options) {
+        walks++;
+        return walkWidgetTreeIncrementally(instance, options);
+      },
+    );
   }
 }
 
@@ -160,6 +160,33 @@ void main() {
       expect(breadcrumb.category, 'device.event');
 
       instance.removeObserver(observer);
+      flutterTrackingEnabledOptions.memoryGovernor.close();
+    });
+
+    testWidgets('memory pressure escalates the memory governor',
+        (WidgetTester tester) async {
+      final observer = SentryWidgetsBindingObserver(
+        hub: MockHub(),
+        options: flutterTrackingDisabledOptions,
+      );
+      final instance = flutterTrackingDisabledOptions.bindingUtils.instance!;
+      instance.addObserver(observer);
+      final governor = flutterTrackingDisabledOptions.memoryGovernor;
+
+      final message = const JSONMessageCodec()
+          .encodeMessage(<String, dynamic>{'type': 'memoryPressure'});
+      Future<void> sendMemoryPressure() => instance.defaultBinaryMessenger
+          // ignore: deprecated_member_use
+          .handlePlatformMessage('flutter/system', message, (_) {});
+
+      await sendMemoryPressure();
+      expect(governor.level, MemoryPressureLevel.high);
+
+      await sendMemoryPressure();
+      expect(governor.level, MemoryPressureLevel.critical);
+
+      instance.removeObserver(observer);
+      governor.close();
     });
 
     testWidgets('disable memory pressure breadcrumb',
@@ -183,6 +210,7 @@ void main() {
       verifyNever(hub.addBreadcrumb(captureAny));
 
       instance.removeObserver(observer);
+      flutterTrackingDisabledOptions.memoryGovernor.close();
     });
 
     testWidgets('lifecycle breadcrumbs', (WidgetTester tester) async {
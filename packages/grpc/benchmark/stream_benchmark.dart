@@ -0,0 +1,154 @@
+// Measures what the SentryGrpcInterceptor adds per message of a streaming
+// call, compared to a client without it.
+//
+// Usage: dart run benchmark/stream_benchmark.dart [--json=<path>]
+//
+// Client and server run in this process and talk over the loopback
+// interface. The results use the format of the `sentry` package benchmarks
+// (packages/dart/benchmark).
+
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:grpc/grpc.dart';
+import 'package:sentry/sentry.dart';
+import 'package:sentry_grpc/sentry_grpc.dart';
+
+const _messageCount = 2000;
+const _duration = Duration(seconds: 2);
+
+Future<void> main(List<String> args) async {
+  String? jsonPath;
+  for (final arg in args) {
+    if (arg.startsWith('--json=')) {
+      jsonPath = arg.substring('--json='.length);
+    } else {
+      stderr.writeln('Unknown argument: $arg');
+      exit(64);
+    }
+  }
+
+  final options = SentryOptions(dsn: 'https://abc@def.ingest.sentry.io/1234')
+    ..tracesSampleRate = 1.0
+    ..transport = _NullTransport();
+  final hub = Hub(options);
+
+  final server = Server.create(services: [_BenchmarkService()]);
+  await server.serve(address: InternetAddress.loopbackIPv4, port: 0);
+  final channel = ClientChannel(
+    'localhost',
+    port: server.port!,
+    options: const ChannelOptions(credentials: ChannelCredentials.insecure()),
+  );
+  final plain = _BenchmarkClient(channel);
+  final instrumented = _BenchmarkClient(
+    channel,
+    interceptors: [SentryGrpcInterceptor(hub: hub)],
+  );
+
+  final results = <String, double>{};
+  Future<void> run(String name, Future<void> Function() op) async {
+    final microsPerOp = await _measure(op);
+    results[name] = microsPerOp;
+    stdout.writeln('$name: ${microsPerOp.toStringAsFixed(3)}us/op');
+  }
+
+  // Every instrumented call runs in a transaction of its own, a single one
+  // would stop taking spans at `maxSpans`. The instrumented results include
+  // starting the transaction and the span of the call.
+  await run('stream $_messageCount messages raw', () async {
+    await plain.streamMany(_messageCount).drain<void>();
+  });
+  await run('stream $_messageCount messages instrumented', () async {
+    hub.startTransaction('benchmark', 'benchmark', bindToScope: true);
+    await instrumented.streamMany(_messageCount).drain<void>();
+  });
+
+  final overhead = (results['stream $_messageCount messages instrumented']! -
+          results['stream $_messageCount messages raw']!) /
+      _messageCount;
+  stdout.writeln(
+    'Added cost per message, including the amortized span: '
+    '${(overhead * 1000).round()}ns',
+  );
+
+  await channel.shutdown();
+  await server.shutdown();
+
+  if (jsonPath != null) {
+    final json = {
+      'dart': Platform.version,
+      'os': Platform.operatingSystem,
+      'benchmarks': {
+        for (final entry in results.entries)
+          entry.key: {'us_per_op': entry.value},
+      },
+    };
+    await File(jsonPath).writeAsString(
+      '${const JsonEncoder.withIndent('  ').convert(json)}\n',
+    );
+  }
+  exit(0);
+}
+
+Future<double> _measure(Future<void> Function() op) async {
+  // Warm up, so the measured code is optimized by the JIT.
+  final warmUp = Stopwatch()..start();
+  while (warmUp.elapsed < _duration ~/ 5) {
+    await op();
+  }
+
+  final stopwatch = Stopwatch()..start();
+  var iterations = 0;
+  while (stopwatch.elapsed < _duration) {
+    await op();
+    iterations++;
+  }
+  return stopwatch.elapsedMicroseconds / iterations;
+}
+
+class _BenchmarkService extends Service {
+  @override
+  String get $name => 'benchmark.BenchmarkService';
+
+  _BenchmarkService() {
+    $addMethod(
+      ServiceMethod<String, String>(
+        'StreamMany',
+        _streamMany,
+        false,
+        true,
+        (List<int> data) => String.fromCharCodes(data),
+        (String value) => value.codeUnits,
+      ),
+    );
+  }
+
+  Stream<String> _streamMany(ServiceCall call, Future<String> request) async* {
+    final count = int.parse(await request);
+    for (var i = 0; i < count; i++) {
+      yield 'message $i';
+    }
+  }
+}
+
+class _BenchmarkClient extends Client {
+  static final _$streamMany = ClientMethod<String, String>(
+    '/benchmark.BenchmarkService/StreamMany',
+    (String v) => v.codeUnits,
+    (List<int> v) => String.fromCharCodes(v),
+  );
+
+  _BenchmarkClient(super.channel, {super.interceptors});
+
+  ResponseStream<String> streamMany(int count) {
+    return $createStreamingCall(_$streamMany, Stream.value('$count'));
+  }
+}
+
+/// Accepts every envelope without encoding or sending it.
+class _NullTransport implements Transport {
+  @override
+  Future<SentryId?> send(SentryEnvelope envelope) async =>
+      envelope.header.eventId;
+}
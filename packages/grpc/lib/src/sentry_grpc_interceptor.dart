@@ -11,6 +11,7 @@ import 'package:sentry/src/tracing/instrumentation/instrumentation.dart';
 import 'package:sentry/src/utils/tracing_utils.dart';
 
 import 'internal_logger.dart';
+import 'sentry_grpc_stream.dart';
 import 'version.dart';
 
 /// A gRPC [ClientInterceptor] that adds Sentry instrumentation to outgoing RPC calls.
@@ -21,8 +22,11 @@ import 'version.dart';
 /// - Records a breadcrumb with the method path, status, and duration.
 /// - Optionally captures failed RPCs (non-OK status codes or transport errors) as Sentry exceptions.
 ///
-/// Server-streaming calls receive header injection only; full span lifecycle tracking
-/// for streaming RPCs will be added in a future release.
+/// Streaming calls get the same span, headers, breadcrumb and capture, but the
+/// span is only finished once the response stream closes. Messages are
+/// aggregated instead of traced one by one: the span holds the number and
+/// serialized size of the messages in each direction, the time to the first
+/// response message, and a histogram of the time between response messages.
 ///
 /// ```dart
 /// final channel = ClientChannel('api.example.com');
@@ -63,6 +67,16 @@ class SentryGrpcInterceptor extends ClientInterceptor {
   final bool _recordBreadcrumbs;
   late final InstrumentationSpanFactory _spanFactory;
 
+  static const _messagesSentKey = 'rpc.messages.sent';
+  static const _messagesReceivedKey = 'rpc.messages.received';
+  static const _bytesSentKey = 'rpc.bytes.sent';
+  static const _bytesReceivedKey = 'rpc.bytes.received';
+  static const _timeToFirstMessageKey = 'rpc.time_to_first_message_ms';
+  static const _interMessageHistogramKey =
+      'rpc.inter_message_latency.histogram';
+  static const _interMessageHistogramBoundsKey =
+      'rpc.inter_message_latency.bounds_ms';
+
   @override
   ResponseFuture<R> interceptUnary<Q, R>(
     ClientMethod<Q, R> method,
@@ -159,11 +173,130 @@ class SentryGrpcInterceptor extends ClientInterceptor {
     CallOptions options,
     ClientStreamingInvoker<Q, R> invoker,
   ) {
-    // Inject trace headers; full span lifecycle for streaming will be added later.
     final parentSpan = _spanFactory.getSpan(_hub);
-    final modifiedOptions =
-        _buildModifiedOptions(options, parentSpan, method.path);
-    return invoker(method, requests, modifiedOptions);
+    if (parentSpan == null && !_recordBreadcrumbs && !_shouldCapture(null)) {
+      final modifiedOptions = _buildModifiedOptions(options, null, method.path);
+      return invoker(method, requests, modifiedOptions);
+    }
+    final span = parentSpan != null
+        ? _spanFactory.createSpan(
+            parentSpan: parentSpan,
+            operation: 'grpc.client',
+            description: method.path,
+          )
+        : null;
+
+    span?.origin = SentryTraceOrigins.autoGrpcClientInterceptor;
+
+    if (span != null) {
+      _attachRpcAttributes(span, method.path);
+      _attachRequestData(span, options);
+    }
+
+    // The messages are counted as they are serialized and deserialized, the
+    // span and breadcrumb are only written once the stream closes.
+    final stats = GrpcStreamStats();
+    final modifiedOptions = _buildModifiedOptions(options, span, method.path);
+    final response = invoker(stats.wrap(method), requests, modifiedOptions);
+
+    return SentryResponseStream<R>(
+      response,
+      (error, stackTrace, cancelled) => unawaited(
+        _finishStreaming(
+          method.path,
+          span,
+          stats,
+          error,
+          stackTrace,
+          cancelled,
+        ),
+      ),
+    );
+  }
+
+  Future<void> _finishStreaming(
+    String methodPath,
+    InstrumentationSpan? span,
+    GrpcStreamStats stats,
+    Object? error,
+    StackTrace? stackTrace,
+    bool cancelled,
+  ) async {
+    final duration = stats.elapsed;
+    final grpcError = error is GrpcError ? error : null;
+    final String statusName;
+    if (error != null) {
+      statusName = grpcError?.codeName ?? 'UNKNOWN';
+      span?.throwable = error;
+      span?.status = _grpcStatusToSpanStatus(grpcError);
+    } else if (cancelled) {
+      statusName = 'CANCELLED';
+      span?.status = const SpanStatus.cancelled();
+    } else {
+      statusName = 'OK';
+      span?.status = const SpanStatus.ok();
+    }
+
+    if (span != null) {
+      span.setData(
+        SemanticAttributesConstants.rpcResponseStatusCode,
+        statusName,
+      );
+      _attachStreamData(span, stats);
+      await span.finish();
+    }
+
+    if (_recordBreadcrumbs) {
+      await _addBreadcrumb(
+        methodPath,
+        error != null
+            ? grpcError?.code ?? StatusCode.unknown
+            : cancelled
+                ? StatusCode.cancelled
+                : StatusCode.ok,
+        statusName,
+        duration,
+        error != null ? SentryLevel.error : SentryLevel.info,
+      );
+    }
+
+    if (error != null && _shouldCapture(grpcError)) {
+      internalLogger.debug(
+        'Capturing exception for failed gRPC call: $methodPath',
+      );
+      await _captureGrpcException(
+        error,
+        methodPath,
+        grpcError,
+        stackTrace ?? StackTrace.current,
+      );
+    }
+  }
+
+  void _attachStreamData(InstrumentationSpan span, GrpcStreamStats stats) {
+    span
+      ..setData(_messagesSentKey, stats.sentMessages)
+      ..setData(_messagesReceivedKey, stats.receivedMessages)
+      ..setData(_bytesSentKey, stats.sentBytes)
+      ..setData(_bytesReceivedKey, stats.receivedBytes);
+    final timeToFirstMessage = stats.timeToFirstMessage;
+    if (timeToFirstMessage != null) {
+      span.setData(
+        _timeToFirstMessageKey,
+        timeToFirstMessage.inMicroseconds / 1000,
+      );
+    }
+    if (stats.receivedMessages > 1) {
+      span
+        ..setData(
+          _interMessageHistogramKey,
+          List<int>.of(stats.interMessageHistogram),
+        )
+        ..setData(
+          _interMessageHistogramBoundsKey,
+          GrpcStreamStats.interMessageBoundsMs,
+        );
+    }
   }
 
   // Sets rpc.system, rpc.service, and rpc.method per OTel gRPC semconv.
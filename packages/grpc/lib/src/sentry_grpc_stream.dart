@@ -0,0 +1,192 @@
+import 'dart:async';
+
+import 'package:grpc/grpc_or_grpcweb.dart';
+import 'package:grpc/service_api.dart';
+import 'package:meta/meta.dart';
+
+/// Message statistics of a streaming gRPC call.
+///
+/// The state is the same for any number of messages: counters, the time of
+/// the first and the last received message, and a fixed-size histogram of
+/// the time between received messages.
+@internal
+class GrpcStreamStats {
+  /// Upper bounds in milliseconds of all but the last histogram bucket. The
+  /// last bucket counts everything above.
+  static const interMessageBoundsMs = [1, 4, 16, 64, 256, 1024, 4096, 16384];
+
+  final _stopwatch = Stopwatch()..start();
+
+  /// Number of request messages sent.
+  int sentMessages = 0;
+
+  /// Serialized size of the request messages sent.
+  int sentBytes = 0;
+
+  /// Number of response messages received.
+  int receivedMessages = 0;
+
+  /// Serialized size of the response messages received.
+  int receivedBytes = 0;
+
+  /// Time from the start of the call to the first response message.
+  Duration? timeToFirstMessage;
+
+  /// Time between consecutive response messages, counted per bucket of
+  /// [interMessageBoundsMs].
+  final interMessageHistogram =
+      List<int>.filled(interMessageBoundsMs.length + 1, 0);
+
+  int _lastReceivedMicros = 0;
+
+  /// Time since the start of the call.
+  Duration get elapsed => _stopwatch.elapsed;
+
+  /// Returns a method that calls [method] and counts the messages and bytes
+  /// going through its serializers, so that no message is serialized twice.
+  ClientMethod<Q, R> wrap<Q, R>(ClientMethod<Q, R> method) {
+    return ClientMethod<Q, R>(
+      method.path,
+      (request) {
+        final bytes = method.requestSerializer(request);
+        sentMessages++;
+        sentBytes += bytes.length;
+        return bytes;
+      },
+      (bytes) {
+        _onReceived(bytes.length);
+        return method.responseDeserializer(bytes);
+      },
+    );
+  }
+
+  void _onReceived(int bytes) {
+    final now = _stopwatch.elapsedMicroseconds;
+    if (receivedMessages == 0) {
+      timeToFirstMessage = Duration(microseconds: now);
+    } else {
+      interMessageHistogram[_bucketOf(now - _lastReceivedMicros)]++;
+    }
+    _lastReceivedMicros = now;
+    receivedMessages++;
+    receivedBytes += bytes;
+  }
+
+  static int _bucketOf(int micros) {
+    for (var i = 0; i < interMessageBoundsMs.length; i++) {
+      if (micros < interMessageBoundsMs[i] * 1000) {
+        return i;
+      }
+    }
+    return interMessageBoundsMs.length;
+  }
+}
+
+/// A [ResponseStream] that passes the messages of another one through and
+/// calls [onDone] once, when the call completes, fails or is cancelled.
+///
+/// Client-streaming calls take their response from [single].
+@internal
+class SentryResponseStream<R> extends StreamView<R>
+    implements ResponseStream<R> {
+  SentryResponseStream._(this._inner, Stream<R> stream) : super(stream);
+
+  /// Wraps [inner]. [onDone] gets the error the call failed with, if any,
+  /// and whether it was cancelled by the caller.
+  factory SentryResponseStream(
+    ResponseStream<R> inner,
+    void Function(Object? error, StackTrace? stackTrace, bool cancelled) onDone,
+  ) {
+    var done = false;
+    Object? error;
+    StackTrace? errorStackTrace;
+    void finish({bool cancelled = false}) {
+      if (done) {
+        return;
+      }
+      done = true;
+      onDone(error, errorStackTrace, cancelled && error == null);
+    }
+
+    late StreamSubscription<R> subscription;
+    // Synchronous, so messages are passed on as they arrive, without another
+    // microtask per message.
+    final controller = StreamController<R>(sync: true);
+    controller
+      ..onListen = () {
+        subscription = inner.listen(
+          controller.add,
+          onError: (Object e, StackTrace stackTrace) {
+            error ??= e;
+            errorStackTrace ??= stackTrace;
+            controller.addError(e, stackTrace);
+          },
+          onDone: () {
+            finish();
+            controller.close();
+          },
+        );
+      }
+      ..onPause = () => subscription.pause()
+      ..onResume = () => subscription.resume()
+      ..onCancel = () {
+        finish(cancelled: true);
+        return subscription.cancel();
+      };
+    return SentryResponseStream._(inner, controller.stream);
+  }
+
+  final ResponseStream<R> _inner;
+
+  @override
+  Future<Map<String, String>> get headers => _inner.headers;
+
+  @override
+  Future<Map<String, String>> get trailers => _inner.trailers;
+
+  @override
+  Future<void> cancel() => _inner.cancel();
+
+  /// The single message of a client-streaming call, which goes through this
+  /// stream so that the call is finished like any other.
+  @override
+  ResponseFuture<R> get single => _SentryResponseFuture(this, super.single);
+}
+
+/// A [ResponseFuture] that completes with [_future] and takes the metadata of
+/// the call from [_stream].
+class _SentryResponseFuture<R> implements ResponseFuture<R> {
+  _SentryResponseFuture(this._stream, this._future);
+
+  final ResponseStream<R> _stream;
+  final Future<R> _future;
+
+  @override
+  Future<Map<String, String>> get headers => _stream.headers;
+
+  @override
+  Future<Map<String, String>> get trailers => _stream.trailers;
+
+  @override
+  Future<void> cancel() => _stream.cancel();
+
+  @override
+  Stream<R> asStream() => _future.asStream();
+
+  @override
+  Future<R> catchError(Function onError, {bool Function(Object error)? test}) =>
+      _future.catchError(onError, test: test);
+
+  @override
+  Future<S> then<S>(FutureOr<S> Function(R value) onValue,
+          {Function? onError}) =>
+      _future.then(onValue, onError: onError);
+
+  @override
+  Future<R> timeout(Duration timeLimit, {FutureOr<R> Function()? onTimeout}) =>
+      _future.timeout(timeLimit, onTimeout: onTimeout);
+
+  @override
+  Future<R> whenComplete(FutureOr<void> Function() action) =>
+      _future.whenComplete(action);
+}
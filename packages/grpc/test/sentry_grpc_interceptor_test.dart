@@ -625,6 +625,151 @@ void main() {
           isTrue,
         );
       });
+
+      test('creates a single span for all messages', () async {
+        final client = fixture.getSut();
+        final tr =
+            fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+        final messages = await client.testStreamingMany(5).toList();
+        await pumpEventQueue();
+        await tr.finish();
+
+        expect(messages, hasLength(5));
+        final tracer = tr as SentryTracer;
+        expect(tracer.children, hasLength(1));
+        final span = tracer.children.first;
+        expect(span.context.operation, 'grpc.client');
+        expect(span.context.description, '/test.TestService/TestStreamingMany');
+        expect(
+          span.origin,
+          SentryTraceOrigins.autoGrpcClientInterceptor,
+        );
+        expect(span.status, SpanStatus.ok());
+        expect(span.finished, isTrue);
+        expect(
+          span.data[SemanticAttributesConstants.rpcResponseStatusCode],
+          'OK',
+        );
+      });
+
+      test('aggregates messages and bytes in each direction', () async {
+        final client = fixture.getSut();
+        final tr =
+            fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+        final messages = await client.testStreamingMany(5).toList();
+        await pumpEventQueue();
+        await tr.finish();
+
+        final data = (tr as SentryTracer).children.first.data;
+        expect(data['rpc.messages.sent'], 1);
+        expect(data['rpc.bytes.sent'], '5'.length);
+        expect(data['rpc.messages.received'], 5);
+        expect(
+          data['rpc.bytes.received'],
+          messages.fold<int>(0, (sum, m) => sum + m.length),
+        );
+        expect(data['rpc.time_to_first_message_ms'], isA<double>());
+        final histogram =
+            data['rpc.inter_message_latency.histogram'] as List<int>;
+        expect(histogram.reduce((a, b) => a + b), 4);
+        expect(
+          data['rpc.inter_message_latency.bounds_ms'],
+          hasLength(histogram.length - 1),
+        );
+      });
+
+      test('sets span status and captures on error', () async {
+        fixture.service.errorToThrow = GrpcError.notFound('not found');
+        final client = fixture.getSut(captureFailedRequests: true);
+        final tr =
+            fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+        await expectLater(
+          client.testStreamingMany(5).toList(),
+          throwsA(isA<GrpcError>()),
+        );
+        await pumpEventQueue();
+        await tr.finish();
+
+        final span = (tr as SentryTracer).children.first;
+        expect(span.status, SpanStatus.notFound());
+        expect(span.throwable, isA<GrpcError>());
+        expect(span.data['rpc.messages.received'], 0);
+      });
+
+      test('sets cancelled status when the caller cancels', () async {
+        final client = fixture.getSut();
+        final tr =
+            fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+        await client.testStreamingMany(5).first;
+        await pumpEventQueue();
+        await tr.finish();
+
+        final span = (tr as SentryTracer).children.first;
+        expect(span.status, SpanStatus.cancelled());
+        expect(span.finished, isTrue);
+      });
+
+      test('adds a single breadcrumb when the stream closes', () async {
+        final client = fixture.getSut(mockHub: fixture.mockHub);
+
+        await client.testStreamingMany(5).toList();
+        await pumpEventQueue();
+
+        expect(fixture.mockHub.addBreadcrumbCalls, hasLength(1));
+        final crumb = fixture.mockHub.addBreadcrumbCalls.first.crumb;
+        expect(crumb.category, 'grpc.client');
+        expect(crumb.level, SentryLevel.info);
+        expect(crumb.data?['method'], '/test.TestService/TestStreamingMany');
+        expect(crumb.data?['status'], 'OK');
+      });
+
+      test('finishes the span of a client-streaming call', () async {
+        final client = fixture.getSut();
+        final tr =
+            fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+        final response = await client.testClientStreaming(
+          Stream.fromIterable(['a', 'b', 'c']),
+        );
+        await pumpEventQueue();
+        await tr.finish();
+
+        expect(response, 'a,b,c');
+        final span = (tr as SentryTracer).children.single;
+        expect(
+          span.context.description,
+          '/test.TestService/TestClientStreaming',
+        );
+        expect(span.status, SpanStatus.ok());
+        expect(span.finished, isTrue);
+        expect(span.data['rpc.messages.sent'], 3);
+        expect(span.data['rpc.messages.received'], 1);
+        final crumb = fixture.hub.scope.breadcrumbs.single;
+        expect(crumb.data?['method'], '/test.TestService/TestClientStreaming');
+        expect(crumb.data?['status'], 'OK');
+      });
+
+      test('sets span status of a failed client-streaming call', () async {
+        fixture.service.errorToThrow = GrpcError.notFound('not found');
+        final client = fixture.getSut();
+        final tr =
+            fixture.hub.startTransaction('name', 'op', bindToScope: true);
+
+        await expectLater(
+          client.testClientStreaming(Stream.value('a')),
+          throwsA(isA<GrpcError>()),
+        );
+        await pumpEventQueue();
+        await tr.finish();
+
+        final span = (tr as SentryTracer).children.single;
+        expect(span.status, SpanStatus.notFound());
+        expect(span.finished, isTrue);
+      });
     });
 
     group('span-first', () {
@@ -684,6 +829,26 @@ class _TestService extends Service {
         (String value) => value.codeUnits,
       ),
     );
+    $addMethod(
+      ServiceMethod<String, String>(
+        'TestClientStreaming',
+        _handleClientStreaming,
+        true,
+        false,
+        (List<int> data) => String.fromCharCodes(data),
+        (String value) => value.codeUnits,
+      ),
+    );
+    $addMethod(
+      ServiceMethod<String, String>(
+        'TestStreamingMany',
+        _handleServerStreamingMany,
+        false,
+        true,
+        (List<int> data) => String.fromCharCodes(data),
+        (String value) => value.codeUnits,
+      ),
+    );
   }
 
   Future<String> _handleUnary(ServiceCall call, Future<String> request) async {
@@ -702,6 +867,28 @@ class _TestService extends Service {
     if (error != null) throw error;
     yield 'pong: ${await request}';
   }
+
+  Future<String> _handleClientStreaming(
+    ServiceCall call,
+    Stream<String> requests,
+  ) async {
+    final messages = await requests.toList();
+    final error = errorToThrow;
+    if (error != null) throw error;
+    return messages.join(',');
+  }
+
+  Stream<String> _handleServerStreamingMany(
+    ServiceCall call,
+    Future<String> request,
+  ) async* {
+    final count = int.parse(await request);
+    final error = errorToThrow;
+    if (error != null) throw error;
+    for (var i = 0; i < count; i++) {
+      yield 'message $i';
+    }
+  }
 }
 
 class _TestClient extends Client {
@@ -717,6 +904,18 @@ class _TestClient extends Client {
     (List<int> v) => String.fromCharCodes(v),
   );
 
+  static final _$testStreamingMany = ClientMethod<String, String>(
+    '/test.TestService/TestStreamingMany',
+    (String v) => v.codeUnits,
+    (List<int> v) => String.fromCharCodes(v),
+  );
+
+  static final _$testClientStreaming = ClientMethod<String, String>(
+    '/test.TestService/TestClientStreaming',
+    (String v) => v.codeUnits,
+    (List<int> v) => String.fromCharCodes(v),
+  );
+
   _TestClient(super.channel, {super.interceptors});
 
   ResponseFuture<String> testMethod(String request, {CallOptions? options}) {
@@ -730,6 +929,25 @@ class _TestClient extends Client {
       options: options,
     );
   }
+
+  ResponseFuture<String> testClientStreaming(
+    Stream<String> requests, {
+    CallOptions? options,
+  }) {
+    return $createStreamingCall(
+      _$testClientStreaming,
+      requests,
+      options: options,
+    ).single;
+  }
+
+  ResponseStream<String> testStreamingMany(int count, {CallOptions? options}) {
+    return $createStreamingCall(
+      _$testStreamingMany,
+      Stream.value('$count'),
+      options: options,
+    );
+  }
 }
 
 // ----- Fixture -----
@@ -800,4 +1018,5 @@ class Fixture {
     );
     return _TestClient(_channel, interceptors: [interceptor]);
   }
+
 }
@@ -28,6 +28,7 @@ class SentryBoxBase<E> implements BoxBase<E> {
         return _boxBase.add(value);
       },
       dbName: name,
+      bytes: payloadSize(value),
     );
   }
 
@@ -172,6 +173,7 @@ class SentryBoxBase<E> implements BoxBase<E> {
         return _boxBase.put(key, value);
       },
       dbName: name,
+      bytes: payloadSize(value),
     );
   }
 
@@ -194,6 +196,7 @@ class SentryBoxBase<E> implements BoxBase<E> {
         return _boxBase.putAt(index, value);
       },
       dbName: name,
+      bytes: payloadSize(value),
     );
   }
 
@@ -1,6 +1,7 @@
 // ignore_for_file: invalid_use_of_internal_member
 
 import 'dart:async';
+import 'dart:typed_data';
 
 import 'package:meta/meta.dart';
 import 'package:sentry/sentry.dart';
@@ -25,7 +26,22 @@ class SentrySpanHelper {
     String description,
     Future<T> Function() execute, {
     String? dbName,
+    int? bytes,
   }) async {
+    final aggregator = _aggregator();
+    if (aggregator != null) {
+      return aggregator.run(
+        _factory.getSpan(_hub),
+        group: dbName ?? SentryHiveImpl.dbSystem,
+        name: description,
+        origin: _origin,
+        execute: execute,
+        bytes: bytes,
+        setSpanData: (span) => _setSpanData(span, dbName),
+        breadcrumb: () => _breadcrumb(description, dbName),
+      );
+    }
+
     final parentSpan = _factory.getSpan(_hub);
     final span = parentSpan != null
         ? _factory.createSpan(
@@ -74,6 +90,19 @@ class SentrySpanHelper {
     T Function() execute, {
     String? dbName,
   }) {
+    final aggregator = _aggregator();
+    if (aggregator != null) {
+      return aggregator.runSync(
+        _factory.getSpan(_hub),
+        group: dbName ?? SentryHiveImpl.dbSystem,
+        name: description,
+        origin: _origin,
+        execute: execute,
+        setSpanData: (span) => _setSpanData(span, dbName),
+        breadcrumb: () => _breadcrumb(description, dbName),
+      );
+    }
+
     final parentSpan = _factory.getSpan(_hub);
     final span = parentSpan != null
         ? _factory.createSpan(
@@ -115,4 +144,45 @@ class SentrySpanHelper {
       _hub.scope.addBreadcrumb(breadcrumb);
     }
   }
+
+  OperationAggregator? _aggregator() => OperationAggregator.of(
+        _hub,
+        operation: SentryHiveImpl.dbOp,
+        system: SentryHiveImpl.dbSystem,
+        // All boxes share one summary span, whatever the origin of their
+        // helper.
+        origin: SentryTraceOrigins.autoDbHive,
+      );
+
+  void _setSpanData(InstrumentationSpan span, String? dbName) {
+    span.setData(SentryHiveImpl.dbSystemKey, SentryHiveImpl.dbSystem);
+    if (dbName != null) {
+      span.setData(SentryHiveImpl.dbNameKey, dbName);
+    }
+  }
+
+  Breadcrumb _breadcrumb(String description, String? dbName) => Breadcrumb(
+        message: description,
+        data: {
+          SentryHiveImpl.dbSystemKey: SentryHiveImpl.dbSystem,
+          if (dbName != null) SentryHiveImpl.dbNameKey: dbName,
+        },
+        type: 'query',
+      );
+}
+
+/// Approximate payload size of [value]: the length in bytes of typed data or
+/// the length of a string, otherwise `null`.
+///
+/// Values that Hive encodes with type adapters are not measured, encoding
+/// them just to count bytes would cost more than the operation.
+@internal
+int? payloadSize(Object? value) {
+  if (value is TypedData) {
+    return value.lengthInBytes;
+  }
+  if (value is String) {
+    return value.length;
+  }
+  return null;
 }
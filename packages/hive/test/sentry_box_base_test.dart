@@ -523,6 +523,77 @@ void main() {
       );
     });
   });
+
+  group('with operation aggregation', () {
+    late Fixture fixture;
+
+    setUp(() async {
+      fixture = Fixture();
+      await fixture.setUp();
+      // Only failures are reported on their own, regardless of timing.
+      fixture.options.operationAggregation = SentryOperationAggregation(
+        outlierThreshold: Duration(minutes: 1),
+      );
+
+      when(fixture.hub.options).thenReturn(fixture.options);
+      when(fixture.hub.getSpan()).thenReturn(fixture.tracer);
+      when(fixture.hub.scope).thenReturn(fixture.scope);
+    });
+
+    tearDown(() async {
+      await fixture.tearDown();
+    });
+
+    OperationAggregator aggregator() => OperationAggregator.of(
+          fixture.hub,
+          operation: SentryHiveImpl.dbOp,
+          system: SentryHiveImpl.dbSystem,
+          // ignore: invalid_use_of_internal_member
+          origin: SentryTraceOrigins.autoDbHive,
+        )!;
+
+    test('summarizes operations into one span', () async {
+      final sut = fixture.getSut();
+
+      await sut.put('a', Person('Joe Dirt'));
+      await sut.put('b', Person('Joe Dirt'));
+      await sut.delete('a');
+      aggregator().flush();
+
+      final span = fixture.tracer.children.single;
+      expect(span.context.operation, SentryHiveImpl.dbOp);
+      expect(span.data[SentryHiveImpl.dbSystemKey], SentryHiveImpl.dbSystem);
+      expect(span.data['db.aggregate.${Fixture.dbName}.put.count'], 2);
+      expect(span.data['db.aggregate.${Fixture.dbName}.delete.count'], 1);
+      expect(fixture.scope.breadcrumbs, isEmpty);
+    });
+
+    test('reports failed operations on their own', () async {
+      when(fixture.mockBox.name).thenReturn(Fixture.dbName);
+      when(fixture.mockBox.delete(any)).thenThrow(fixture.exception);
+      final sut = fixture.getSut(injectMockBox: true);
+
+      try {
+        await sut.delete('fixture-key');
+      } catch (error) {
+        expect(error, fixture.exception);
+      }
+      aggregator().flush();
+
+      final spans = fixture.tracer.children;
+      expect(spans.length, 2);
+      verifyErrorSpan('delete', fixture.exception, spans.last);
+      expect(
+        spans.first.data['db.aggregate.${Fixture.dbName}.delete.errors'],
+        1,
+      );
+      verifyBreadcrumb(
+        'delete',
+        fixture.getCreatedBreadcrumb(),
+        status: 'internal_error',
+      );
+    });
+  });
 }
 
 class Fixture {
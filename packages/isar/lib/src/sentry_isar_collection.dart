@@ -297,6 +297,7 @@ class SentryIsarCollection<OBJ> implements IsarCollection<OBJ> {
       },
       dbName: _dbName,
       collectionName: name,
+      bytes: jsonBytes.lengthInBytes,
     );
   }
 
@@ -26,7 +26,22 @@ class SentrySpanHelper {
     Future<T> Function() execute, {
     String? dbName,
     String? collectionName,
+    int? bytes,
   }) async {
+    final aggregator = _aggregator();
+    if (aggregator != null) {
+      return aggregator.run(
+        _factory.getSpan(_hub),
+        group: collectionName ?? dbName ?? SentryIsar.dbSystem,
+        name: description,
+        origin: _origin,
+        execute: execute,
+        bytes: bytes,
+        setSpanData: (span) => _setSpanData(span, dbName, collectionName),
+        breadcrumb: () => _breadcrumb(description, dbName, collectionName),
+      );
+    }
+
     final parentSpan = _factory.getSpan(_hub);
     final span = parentSpan != null
         ? _factory.createSpan(
@@ -80,6 +95,19 @@ class SentrySpanHelper {
     String? dbName,
     String? collectionName,
   }) {
+    final aggregator = _aggregator();
+    if (aggregator != null) {
+      return aggregator.runSync(
+        _factory.getSpan(_hub),
+        group: collectionName ?? dbName ?? SentryIsar.dbSystem,
+        name: description,
+        origin: _origin,
+        execute: execute,
+        setSpanData: (span) => _setSpanData(span, dbName, collectionName),
+        breadcrumb: () => _breadcrumb(description, dbName, collectionName),
+      );
+    }
+
     final parentSpan = _factory.getSpan(_hub);
     final span = parentSpan != null
         ? _factory.createSpan(
@@ -125,4 +153,42 @@ class SentrySpanHelper {
       _hub.scope.addBreadcrumb(breadcrumb);
     }
   }
+
+  OperationAggregator? _aggregator() => OperationAggregator.of(
+        _hub,
+        operation: SentryIsar.dbOp,
+        system: SentryIsar.dbSystem,
+        // All collections share one summary span, whatever the origin of their
+        // helper.
+        origin: SentryTraceOrigins.autoDbIsar,
+      );
+
+  void _setSpanData(
+    InstrumentationSpan span,
+    String? dbName,
+    String? collectionName,
+  ) {
+    span.setData(SentryIsar.dbSystemKey, SentryIsar.dbSystem);
+    if (dbName != null) {
+      span.setData(SentryIsar.dbNameKey, dbName);
+    }
+    if (collectionName != null) {
+      span.setData(SentryIsar.dbCollectionKey, collectionName);
+    }
+  }
+
+  Breadcrumb _breadcrumb(
+    String description,
+    String? dbName,
+    String? collectionName,
+  ) =>
+      Breadcrumb(
+        message: description,
+        data: {
+          SentryIsar.dbSystemKey: SentryIsar.dbSystem,
+          if (dbName != null) SentryIsar.dbNameKey: dbName,
+          if (collectionName != null) SentryIsar.dbCollectionKey: collectionName,
+        },
+        type: 'query',
+      );
 }
@@ -0,0 +1,126 @@
+import 'package:gql/ast.dart';
+import 'package:gql/language.dart' show printNode;
+import 'package:gql_exec/gql_exec.dart';
+import 'package:meta/meta.dart';
+import 'package:sentry/sentry.dart';
+
+import 'package:sentry_link/src/extension.dart';
+
+/// What the links report about a GraphQL operation: its name and type, a
+/// hash of its document and the document text shortened to
+/// [GraphQlOperationCache.maxQueryLength].
+@internal
+class GraphQlOperationInfo {
+  GraphQlOperationInfo._({
+    required this.name,
+    required this.type,
+    required this.hash,
+    required this.query,
+    required this.queryTruncated,
+  }) : description = 'GraphQL: "${name ?? 'unnamed'}" ${type?.sentryType}';
+
+  /// The operation name, `null` for anonymous operations.
+  final String? name;
+
+  /// The operation type, `null` if the document has no such operation.
+  final OperationType? type;
+
+  /// Hex FNV-1a hash of the whole printed document. Equal for equal
+  /// documents, also when [query] is truncated.
+  final String hash;
+
+  /// The printed document, at most [GraphQlOperationCache.maxQueryLength]
+  /// characters long.
+  final String query;
+
+  /// Whether [query] is shorter than the printed document.
+  final bool queryTruncated;
+
+  /// Span and breadcrumb description of the operation.
+  final String description;
+
+  /// Data describing the operation, for breadcrumbs and spans.
+  Map<String, dynamic> toJson() => {
+        'name': name,
+        'document': query,
+        'document_hash': hash,
+        if (queryTruncated) 'document_truncated': true,
+      };
+}
+
+/// Caches [GraphQlOperationInfo] per document instance and operation name.
+///
+/// Apps usually send the same few documents, which are parsed once and then
+/// reused, so the document is only printed, hashed and searched for its
+/// operation type the first time it is sent. Entries go away together with
+/// their document.
+@internal
+class GraphQlOperationCache {
+  /// The cache used by all links.
+  static final shared = GraphQlOperationCache();
+
+  /// Maximum length of [GraphQlOperationInfo.query].
+  static const maxQueryLength = 1024;
+
+  final _byDocument = Expando<Map<String?, GraphQlOperationInfo>>();
+
+  /// Returns the info of [operation], computing it on first use.
+  GraphQlOperationInfo infoOf(Operation operation) {
+    final byName = _byDocument[operation.document] ??= {};
+    return byName[operation.operationName] ??= _compute(operation);
+  }
+
+  static GraphQlOperationInfo _compute(Operation operation) {
+    final printed = printNode(operation.document);
+    final truncated = printed.length > maxQueryLength;
+    return GraphQlOperationInfo._(
+      name: operation.operationName,
+      type: operation.getOperationType(),
+      hash: _fnv1a(printed),
+      query: truncated ? printed.substring(0, maxQueryLength) : printed,
+      queryTruncated: truncated,
+    );
+  }
+
+  // 32 bits, so the result is the same on the web. The multiplication by
+  // the FNV prime 2^24 + 0x193 is split so no step exceeds 2^53.
+  static String _fnv1a(String value) {
+    var hash = 0x811c9dc5;
+    for (var i = 0; i < value.length; i++) {
+      hash ^= value.codeUnitAt(i);
+      hash = (((hash << 24) & 0xffffffff) + hash * 0x193) & 0xffffffff;
+    }
+    return hash.toRadixString(16).padLeft(8, '0');
+  }
+}
+
+/// Shortened counterparts of the [SentryRequestExtension] methods, based on
+/// the cached [GraphQlOperationInfo].
+@internal
+extension SentryRequestInfoExtension on Request {
+  /// The cached info of the operation of this request.
+  GraphQlOperationInfo get operationInfo =>
+      GraphQlOperationCache.shared.infoOf(operation);
+
+  /// Like [SentryRequestExtension.toJson], with the shortened document.
+  Map<String, dynamic> toShortJson() => {
+        'operation': operationInfo.toJson(),
+        'variables': variables,
+      };
+
+  /// Like [SentryRequestExtension.toSentryRequest], with the shortened
+  /// document and its hash.
+  SentryRequest toShortSentryRequest() {
+    final info = operationInfo;
+    return SentryRequest(
+      apiTarget: 'graphql',
+      data: {
+        'query': info.query,
+        'queryHash': info.hash,
+        if (info.queryTruncated) 'queryTruncated': true,
+        'variables': variables,
+        'operationName': operation.operationName,
+      },
+    );
+  }
+}
@@ -4,7 +4,7 @@ import 'package:gql_exec/gql_exec.dart';
 import 'package:gql_link/gql_link.dart';
 import 'package:sentry/sentry.dart';
 import 'package:sentry_link/src/sentry_link.dart';
-import 'package:sentry_link/src/extension.dart';
+import 'package:sentry_link/src/graphql_operation_cache.dart';
 
 /// Only handles success cases. Error cases are handled by [SentryLink].
 class SentryBreadcrumbLink extends Link {
@@ -20,9 +20,7 @@ class SentryBreadcrumbLink extends Link {
       'This is not a terminating link and needs a NextLink',
     );
 
-    final operationType = request.operation.getOperationType()?.sentryType;
-    final description =
-        'GraphQL: "${request.operation.operationName ?? 'unnamed'}" $operationType';
+    final info = request.operationInfo;
 
     final stopwatch = Stopwatch()..start();
 
@@ -31,7 +29,7 @@ class SentryBreadcrumbLink extends Link {
         stopwatch.stop();
         // Errors are handled by SentryLink, so opt-out if there are errors.
         if (data.errors == null) {
-          _addBreadcrumb(description, stopwatch.elapsed, data);
+          _addBreadcrumb(info, stopwatch.elapsed, data);
         }
         sink.add(data);
       },
@@ -46,15 +44,18 @@ class SentryBreadcrumbLink extends Link {
   }
 
   void _addBreadcrumb(
-    String description,
+    GraphQlOperationInfo info,
     Duration duration,
     Response response,
   ) {
     _hub.addBreadcrumb(Breadcrumb(
       category: 'GraphQL',
-      message: description,
+      message: info.description,
       type: 'query',
-      data: {'duration': duration.toString()},
+      data: {
+        'duration': duration.toString(),
+        'document_hash': info.hash,
+      },
     ));
   }
 }
@@ -3,6 +3,7 @@ import 'package:gql_exec/gql_exec.dart';
 import 'package:gql_link/gql_link.dart';
 import 'package:sentry/sentry.dart';
 import 'package:sentry_link/src/extension.dart';
+import 'package:sentry_link/src/graphql_operation_cache.dart';
 
 /// Provides a [Link] which captures exceptions and GraphQL errors
 class SentryLink {
@@ -65,7 +66,7 @@ class SentryLinkHandler {
         category: 'GraphQLError',
         type: 'error',
         data: {
-          'request': request.toJson(),
+          'request': request.toShortJson(),
           'response': response.toJson(),
         },
       ));
@@ -92,7 +93,7 @@ class SentryLinkHandler {
         level: SentryLevel.error,
         category: 'LinkException',
         type: 'error',
-        data: request.toJson(),
+        data: request.toShortJson(),
       ));
     } else if (reportExceptions) {
       Response? response;
@@ -121,9 +122,9 @@ SentryEvent _eventFromRequestAndResponse({
   int? statusCode,
   Object? exception,
 }) {
-  final sentryRequest = request.toSentryRequest();
+  final sentryRequest = request.toShortSentryRequest();
   final operationName = request.operation.operationName ?? 'unnamed operation';
-  final type = request.operation.getOperationType();
+  final type = request.operationInfo.type;
 
   final sentryResponse = response?.toSentryResponse(statusCode);
   ThrowableMechanism? throwableMechanism;
@@ -5,6 +5,8 @@ import 'dart:async';
 import 'package:gql_exec/gql_exec.dart';
 import 'package:gql_link/gql_link.dart';
 import 'package:sentry/sentry.dart';
+import 'package:sentry_link/src/graphql_operation_cache.dart';
+import 'package:sentry_link/src/sentry_tracing_link.dart';
 
 class SentryRequestSerializer implements RequestSerializer {
   SentryRequestSerializer({RequestSerializer? inner, Hub? hub})
@@ -27,6 +29,10 @@ class SentryRequestSerializer implements RequestSerializer {
             description: 'GraphGL request serialization',
           )
         : null;
+    span?.setData(
+      SentryTracingLink.documentHashKey,
+      request.operationInfo.hash,
+    );
 
     Map<String, dynamic> result;
     try {
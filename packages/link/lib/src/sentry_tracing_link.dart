@@ -4,8 +4,10 @@ import 'dart:async';
 
 import 'package:gql_exec/gql_exec.dart';
 import 'package:gql_link/gql_link.dart';
+import 'package:meta/meta.dart';
 import 'package:sentry/sentry.dart';
 import 'package:sentry_link/src/extension.dart';
+import 'package:sentry_link/src/graphql_operation_cache.dart';
 
 class SentryTracingLink extends Link {
   /// If [shouldStartTransaction] is set to true, a [SentryTransaction]
@@ -27,6 +29,11 @@ class SentryTracingLink extends Link {
   final Hub _hub;
   late final InstrumentationSpanFactory _spanFactory;
 
+  /// Span data key of the hash of the GraphQL document, see
+  /// [GraphQlOperationInfo.hash].
+  @internal
+  static const documentHashKey = 'graphql.document.hash';
+
   /// If [shouldStartTransaction] is set to true, a [SentryTransaction]
   /// is automatically created for each GraphQL query/mutation.
   /// If a transaction is already bound to scope, no [SentryTransaction]
@@ -45,15 +52,15 @@ class SentryTracingLink extends Link {
       'This is not a terminating link and needs a NextLink',
     );
 
-    final operationType = request.operation.getOperationType();
-    final sentryOperation = operationType?.sentryOperation ?? 'unknown';
-    final sentryType = operationType?.sentryType;
+    final info = request.operationInfo;
+    final sentryOperation = info.type?.sentryOperation ?? 'unknown';
 
     final span = _startInactiveSpan(
-      'GraphQL: "${request.operation.operationName ?? 'unnamed'}" $sentryType',
+      info.description,
       sentryOperation,
       shouldStartTransaction,
     );
+    span?.setData(documentHashKey, info.hash);
     return forward!(request).transform(StreamTransformer.fromHandlers(
       handleData: (data, sink) {
         final hasGraphQlError = data.errors?.isNotEmpty ?? false;
@@ -0,0 +1,100 @@
+import 'package:gql/ast.dart';
+import 'package:gql/language.dart';
+import 'package:gql_exec/gql_exec.dart';
+import 'package:sentry_link/src/graphql_operation_cache.dart';
+import 'package:test/test.dart';
+
+void main() {
+  group(GraphQlOperationCache, () {
+    late GraphQlOperationCache sut;
+
+    setUp(() {
+      sut = GraphQlOperationCache();
+    });
+
+    test('resolves name, type and description', () {
+      final info = sut.infoOf(
+        Operation(
+          document: parseString('mutation AddUser { addUser { id } }'),
+          operationName: 'AddUser',
+        ),
+      );
+
+      expect(info.name, 'AddUser');
+      expect(info.type, OperationType.mutation);
+      expect(info.description, 'GraphQL: "AddUser" mutation');
+      expect(info.queryTruncated, false);
+      expect(info.query, startsWith('mutation AddUser'));
+    });
+
+    test('returns the cached info for the same document', () {
+      final document = parseString('query GetUser { user { name } }');
+
+      final first = sut.infoOf(
+        Operation(document: document, operationName: 'GetUser'),
+      );
+      final second = sut.infoOf(
+        Operation(document: document, operationName: 'GetUser'),
+      );
+
+      expect(second, same(first));
+    });
+
+    test('caches each operation of a document separately', () {
+      final document = parseString(
+        'query GetUser { user { name } } mutation AddUser { addUser { id } }',
+      );
+
+      final query = sut.infoOf(
+        Operation(document: document, operationName: 'GetUser'),
+      );
+      final mutation = sut.infoOf(
+        Operation(document: document, operationName: 'AddUser'),
+      );
+
+      expect(query.type, OperationType.query);
+      expect(mutation.type, OperationType.mutation);
+      expect(query.hash, mutation.hash);
+    });
+
+    test('equal documents parsed separately have the same hash', () {
+      const text = 'query GetUser { user { name } }';
+
+      final first = sut.infoOf(Operation(document: parseString(text)));
+      final second = sut.infoOf(Operation(document: parseString(text)));
+
+      expect(second, isNot(same(first)));
+      expect(second.hash, first.hash);
+      expect(first.hash, hasLength(8));
+    });
+
+    test('truncates long documents', () {
+      final fields = List.generate(500, (i) => 'field$i').join(' ');
+      final info = sut.infoOf(
+        Operation(document: parseString('query Long { $fields }')),
+      );
+
+      expect(info.queryTruncated, true);
+      expect(info.query, hasLength(GraphQlOperationCache.maxQueryLength));
+      expect(info.toJson()['document_truncated'], true);
+    });
+
+    test('short request data uses the shortened document and its hash', () {
+      final request = Request(
+        operation: Operation(
+          document: parseString('query GetUser { user { name } }'),
+          operationName: 'GetUser',
+        ),
+        variables: const {'id': '1'},
+      );
+
+      final data = request.toShortSentryRequest().data as Map;
+
+      expect(data['query'], request.operationInfo.query);
+      expect(data['queryHash'], request.operationInfo.hash);
+      expect(data['operationName'], 'GetUser');
+      expect(data['variables'], {'id': '1'});
+      expect(data.containsKey('queryTruncated'), false);
+    });
+  });
+}
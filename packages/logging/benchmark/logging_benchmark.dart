@@ -0,0 +1,101 @@
+// Measures how many `package:logging` records per second go through the
+// LoggingIntegration, per kind of sink.
+//
+// Usage: dart run benchmark/logging_benchmark.dart [--json=<path>]
+//
+// The results use the format of the `sentry` package benchmarks
+// (packages/dart/benchmark).
+
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:logging/logging.dart';
+import 'package:sentry/sentry.dart';
+import 'package:sentry_logging/sentry_logging.dart';
+
+const _recordCount = 1000000;
+
+Future<void> main(List<String> args) async {
+  String? jsonPath;
+  for (final arg in args) {
+    if (arg.startsWith('--json=')) {
+      jsonPath = arg.substring('--json='.length);
+    } else {
+      stderr.writeln('Unknown argument: $arg');
+      exit(64);
+    }
+  }
+
+  Logger.root.level = Level.ALL;
+  final logger = Logger('benchmark');
+
+  final results = <String, double>{};
+  Future<void> run(
+    String name,
+    Level level, {
+    bool enableLogs = false,
+  }) async {
+    final integration = LoggingIntegration(
+      minSentryLogLevel: enableLogs ? Level.INFO : Level.OFF,
+    );
+    await Sentry.init((options) {
+      options
+        ..dsn = 'https://abc@def.ingest.sentry.io/1234'
+        ..enableLogs = enableLogs
+        ..transport = _NullTransport()
+        ..addIntegration(integration);
+    });
+
+    // Warm up, so the measured code is optimized by the JIT.
+    for (var i = 0; i < _recordCount ~/ 10; i++) {
+      logger.log(level, 'message');
+    }
+    await Future<void>.delayed(Duration.zero);
+
+    final stopwatch = Stopwatch()..start();
+    for (var i = 0; i < _recordCount; i++) {
+      logger.log(level, 'message');
+    }
+    stopwatch.stop();
+    // Lets pending breadcrumb and log futures complete before the next run.
+    await Future<void>.delayed(Duration.zero);
+    await Sentry.close();
+
+    final microsPerOp = stopwatch.elapsedMicroseconds / _recordCount;
+    results[name] = microsPerOp;
+    final perSecond = _recordCount / stopwatch.elapsed.inMicroseconds * 1e6;
+    stdout.writeln(
+      '$name: ${microsPerOp.toStringAsFixed(3)}us/op, '
+      '${perSecond.round()} records/s',
+    );
+  }
+
+  await run('1M records below all thresholds', Level.FINE);
+  await run('1M records as breadcrumbs', Level.INFO);
+  await run('1M records as breadcrumbs and logs', Level.INFO, enableLogs: true);
+
+  if (jsonPath != null) {
+    final json = {
+      'dart': Platform.version,
+      'os': Platform.operatingSystem,
+      'benchmarks': {
+        for (final entry in results.entries)
+          entry.key: {
+            'us_per_op': entry.value,
+            'iterations': _recordCount,
+          },
+      },
+    };
+    await File(jsonPath).writeAsString(
+      '${const JsonEncoder.withIndent('  ').convert(json)}\n',
+    );
+  }
+  exit(0);
+}
+
+/// Accepts every envelope without encoding or sending it.
+class _NullTransport implements Transport {
+  @override
+  Future<SentryId?> send(SentryEnvelope envelope) async =>
+      envelope.header.eventId;
+}
@@ -43,11 +43,28 @@ class LoggingIntegration implements Integration<SentryOptions> {
     Level minSentryLogLevel = Level.INFO,
   })  : _minBreadcrumbLevel = minBreadcrumbLevel,
         _minEventLevel = minEventLevel,
-        _minSentryLogLevel = minSentryLogLevel;
+        _minSentryLogLevel = minSentryLogLevel,
+        _minLevelValue = [
+          minBreadcrumbLevel.value,
+          minEventLevel.value,
+          minSentryLogLevel.value,
+        ].reduce((a, b) => a < b ? a : b) {
+    for (final level in Level.LEVELS) {
+      _routes[level.value] = _resolveRoute(level);
+    }
+  }
 
   final Level _minBreadcrumbLevel;
   final Level _minEventLevel;
   final Level _minSentryLogLevel;
+
+  /// Records below this level go nowhere and are dropped right away.
+  final int _minLevelValue;
+
+  /// Where records go, by level value. The standard levels are resolved
+  /// up front, custom ones when they are first logged.
+  final _routes = <int, _Route>{};
+
   late StreamSubscription<LogRecord> _subscription;
   late Hub _hub;
   late SentryOptions _options;
@@ -82,52 +99,109 @@ class LoggingIntegration implements Integration<SentryOptions> {
     return logLevel >= minLevel;
   }
 
-  Future<void> _onLog(LogRecord record) async {
+  _Route _resolveRoute(Level level) {
+    return _Route(
+      event: _isLoggable(level, _minEventLevel),
+      breadcrumb: _isLoggable(level, _minBreadcrumbLevel),
+      log: _isLoggable(level, _minSentryLogLevel) ? _logMethodOf(level) : null,
+    );
+  }
+
+  void _onLog(LogRecord record) {
+    final level = record.level;
+    if (level.value < _minLevelValue) {
+      return;
+    }
+    final route = _routes[level.value] ??= _resolveRoute(level);
+    if (route.event) {
+      unawaited(_captureEvent(record, route));
+    } else {
+      _dispatch(record, route);
+    }
+  }
+
+  Future<void> _captureEvent(LogRecord record, _Route route) async {
     // The event must be logged first, otherwise the log would also be added
     // to the breadcrumbs for itself.
-    if (_isLoggable(record.level, _minEventLevel)) {
-      await _hub.captureEvent(
-        record.toEvent(),
-        stackTrace: record.stackTrace,
-        hint: Hint.withMap({TypeCheckHint.record: record}),
-      );
-    }
+    await _hub.captureEvent(
+      record.toEvent(),
+      stackTrace: record.stackTrace,
+      hint: Hint.withMap({TypeCheckHint.record: record}),
+    );
+    _dispatch(record, route);
+  }
 
-    if (_isLoggable(record.level, _minBreadcrumbLevel)) {
-      await _hub.addBreadcrumb(
-        record.toBreadcrumb(),
-        hint: Hint.withMap({TypeCheckHint.record: record}),
+  // Neither the breadcrumb nor the log is awaited: both are added to their
+  // buffers synchronously, so records logged in a burst don't each wait for
+  // the previous one.
+  void _dispatch(LogRecord record, _Route route) {
+    if (route.breadcrumb) {
+      unawaited(
+        _hub.addBreadcrumb(
+          record.toBreadcrumb(),
+          hint: Hint.withMap({TypeCheckHint.record: record}),
+        ),
       );
     }
 
-    if (_isLoggable(record.level, _minSentryLogLevel)) {
+    final log = route.log;
+    if (log != null) {
       final attributes = {
         'loggerName': SentryAttribute.string(record.loggerName),
         'sequenceNumber': SentryAttribute.int(record.sequenceNumber),
         'time': SentryAttribute.int(record.time.millisecondsSinceEpoch),
         'sentry.origin': SentryAttribute.string(origin),
       };
-
-      // Map log levels based on value ranges
-      final levelValue = record.level.value;
-      if (levelValue >= Level.SEVERE.value) {
-        // >= 1000 → error
-        await _options.logger.error(record.message, attributes: attributes);
-      } else if (levelValue >= Level.WARNING.value) {
-        // >= 900 → warn
-        await _options.logger.warn(record.message, attributes: attributes);
-      } else if (levelValue >= Level.INFO.value) {
-        // >= 800 → info
-        await _options.logger.info(record.message, attributes: attributes);
-      } else if (levelValue >= Level.CONFIG.value ||
-          levelValue == Level.FINE.value ||
-          levelValue == Level.ALL.value) {
-        // >= 700 || 500 || 0 → debug
-        await _options.logger.debug(record.message, attributes: attributes);
-      } else {
-        // < 700 → trace
-        await _options.logger.trace(record.message, attributes: attributes);
+      final result = log(_options.logger, record.message, attributes);
+      if (result is Future<void>) {
+        unawaited(result);
       }
     }
   }
+
+  static _LogMethod _logMethodOf(Level level) {
+    // Map log levels based on value ranges
+    final levelValue = level.value;
+    if (levelValue >= Level.SEVERE.value) {
+      // >= 1000 → error
+      return (logger, body, attributes) =>
+          logger.error(body, attributes: attributes);
+    } else if (levelValue >= Level.WARNING.value) {
+      // >= 900 → warn
+      return (logger, body, attributes) =>
+          logger.warn(body, attributes: attributes);
+    } else if (levelValue >= Level.INFO.value) {
+      // >= 800 → info
+      return (logger, body, attributes) =>
+          logger.info(body, attributes: attributes);
+    } else if (levelValue >= Level.CONFIG.value ||
+        levelValue == Level.FINE.value ||
+        levelValue == Level.ALL.value) {
+      // >= 700 || 500 || 0 → debug
+      return (logger, body, attributes) =>
+          logger.debug(body, attributes: attributes);
+    } else {
+      // < 700 → trace
+      return (logger, body, attributes) =>
+          logger.trace(body, attributes: attributes);
+    }
+  }
+}
+
+typedef _LogMethod = FutureOr<void> Function(
+  SentryLogger logger,
+  String body,
+  Map<String, SentryAttribute> attributes,
+);
+
+/// The sinks that accept records of one level.
+class _Route {
+  _Route({required this.event, required this.breadcrumb, required this.log});
+
+  final bool event;
+  final bool breadcrumb;
+
+  /// The [SentryLogger] method for the level, `null` if records of the level
+  /// are not sent as logs.
+  final _LogMethod? log;
 }
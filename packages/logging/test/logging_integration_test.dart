@@ -68,6 +68,22 @@ void main() {
     expect(fixture.hub.breadcrumbs.length, 1);
   });
 
+  test('adds breadcrumbs of a burst of records in order, without waiting', () {
+    final sut = fixture.createSut(minBreadcrumbLevel: Level.INFO);
+    sut.call(fixture.hub, fixture.options);
+
+    final log = Logger('FooBarLogger');
+    log.info('first');
+    log.fine('filtered');
+    log.warning('second');
+    log.log(Level('CUSTOM', 850), 'third');
+
+    expect(
+      fixture.hub.breadcrumbs.map((it) => it.breadcrumb.message),
+      ['first', 'second', 'third'],
+    );
+  });
+
   test('passes log records as hints', () {
     final sut = fixture.createSut(
       minBreadcrumbLevel: Level.INFO,
@@ -7,6 +7,7 @@ import 'package:sqflite_common/src/sql_builder.dart';
 
 import 'sentry_database.dart';
 import 'utils/sentry_database_span_attributes.dart';
+import 'utils/sentry_query_aggregation.dart';
 
 /// A [Batch] wrapper that adds Sentry support.
 ///
@@ -52,6 +53,22 @@ class SentryBatch implements Batch {
   Future<List<Object?>> apply({bool? noResult, bool? continueOnError}) {
     return Future<List<Object?>>(() async {
       final parent = _spanFactory.getSpan(_hub);
+      final aggregated = aggregateQuery(
+        _hub,
+        parent,
+        sql: _buffer.toString().trim(),
+        operation: SentryDatabase.dbOp,
+        // ignore: invalid_use_of_internal_member
+        origin: SentryTraceOrigins.autoDbSqfliteBatch,
+        dbName: _dbName,
+        execute: () => _batch.apply(
+          noResult: noResult,
+          continueOnError: continueOnError,
+        ),
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
 
       final span = parent != null
           ? _spanFactory.createSpan(
@@ -108,6 +125,23 @@ class SentryBatch implements Batch {
   }) {
     return Future<List<Object?>>(() async {
       final parent = _spanFactory.getSpan(_hub);
+      final aggregated = aggregateQuery(
+        _hub,
+        parent,
+        sql: _buffer.toString().trim(),
+        operation: SentryDatabase.dbOp,
+        // ignore: invalid_use_of_internal_member
+        origin: SentryTraceOrigins.autoDbSqfliteBatch,
+        dbName: _dbName,
+        execute: () => _batch.commit(
+          exclusive: exclusive,
+          noResult: noResult,
+          continueOnError: continueOnError,
+        ),
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
 
       final span = parent != null
           ? _spanFactory.createSpan(
@@ -12,6 +12,7 @@ import 'sentry_database_executor.dart';
 import 'sentry_sqflite_transaction.dart';
 import 'version.dart';
 import 'utils/sentry_database_span_attributes.dart';
+import 'utils/sentry_query_aggregation.dart';
 import 'package:path/path.dart' as p;
 
 /// A [Database] wrapper that adds Sentry support.
@@ -211,6 +212,7 @@ class SentryDatabase extends SentryDatabaseExecutor
 
         rethrow;
       } finally {
+        flushQueryAggregation(_hub);
         await span?.finish();
 
         // ignore: invalid_use_of_internal_member
@@ -279,6 +281,7 @@ class SentryDatabase extends SentryDatabaseExecutor
 
         rethrow;
       } finally {
+        flushQueryAggregation(_hub);
         await span?.finish();
 
         // ignore: invalid_use_of_internal_member
@@ -12,6 +12,7 @@ import 'package:sqflite_common/src/transaction.dart';
 import 'sentry_batch.dart';
 import 'sentry_database.dart';
 import 'utils/sentry_database_span_attributes.dart';
+import 'utils/sentry_query_aggregation.dart';
 
 @internal
 // ignore: public_member_api_docs
@@ -49,6 +50,28 @@ class SentryDatabaseExecutor
     return _parentSpan ?? _spanFactory.getSpan(_hub);
   }
 
+  /// Runs [execute] through [aggregateQuery] with the origin and database
+  /// name of this executor.
+  Future<T>? _aggregate<T>(
+    // ignore: invalid_use_of_internal_member
+    InstrumentationSpan? parent, {
+    required String sql,
+    required String operation,
+    required Future<T> Function() execute,
+    int? Function(T result)? rowsOf,
+  }) =>
+      aggregateQuery(
+        _hub,
+        parent,
+        sql: sql,
+        operation: operation,
+        // ignore: invalid_use_of_internal_member
+        origin: SentryTraceOrigins.autoDbSqfliteDatabaseExecutor,
+        dbName: _dbName,
+        execute: execute,
+        rowsOf: rowsOf,
+      );
+
   @override
   SqfliteDatabase get db => (_executor as SqfliteDatabaseExecutor).db;
 
@@ -67,6 +90,18 @@ class SentryDatabaseExecutor
       final parent = _getParent();
       final builder =
           SqlBuilder.delete(table, where: where, whereArgs: whereArgs);
+      final aggregated = _aggregate(
+        parent,
+        sql: builder.sql,
+        operation: SentryDatabase.dbSqlExecuteOp,
+        execute: () =>
+            _executor.delete(table, where: where, whereArgs: whereArgs),
+        rowsOf: (rows) => rows,
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -113,6 +148,16 @@ class SentryDatabaseExecutor
   Future<void> execute(String sql, [List<Object?>? arguments]) {
     return Future<void>(() async {
       final parent = _getParent();
+      final aggregated = _aggregate(
+        parent,
+        sql: sql,
+        operation: SentryDatabase.dbSqlExecuteOp,
+        execute: () => _executor.execute(sql, arguments),
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -167,6 +212,21 @@ class SentryDatabaseExecutor
         nullColumnHack: nullColumnHack,
         conflictAlgorithm: conflictAlgorithm,
       );
+      final aggregated = _aggregate(
+        parent,
+        sql: builder.sql,
+        operation: SentryDatabase.dbSqlExecuteOp,
+        execute: () => _executor.insert(
+          table,
+          values,
+          nullColumnHack: nullColumnHack,
+          conflictAlgorithm: conflictAlgorithm,
+        ),
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -240,6 +300,28 @@ class SentryDatabaseExecutor
         offset: offset,
         whereArgs: whereArgs,
       );
+      final aggregated = _aggregate(
+        parent,
+        sql: builder.sql,
+        operation: SentryDatabase.dbSqlQueryOp,
+        execute: () => _executor.query(
+          table,
+          distinct: distinct,
+          columns: columns,
+          where: where,
+          whereArgs: whereArgs,
+          groupBy: groupBy,
+          having: having,
+          orderBy: orderBy,
+          limit: limit,
+          offset: offset,
+        ),
+        rowsOf: (rows) => rows.length,
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -320,6 +402,28 @@ class SentryDatabaseExecutor
         offset: offset,
         whereArgs: whereArgs,
       );
+      final aggregated = _aggregate(
+        parent,
+        sql: builder.sql,
+        operation: SentryDatabase.dbSqlQueryOp,
+        execute: () => _executor.queryCursor(
+          table,
+          distinct: distinct,
+          columns: columns,
+          where: where,
+          whereArgs: whereArgs,
+          groupBy: groupBy,
+          having: having,
+          orderBy: orderBy,
+          limit: limit,
+          offset: offset,
+          bufferSize: bufferSize,
+        ),
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -377,6 +481,17 @@ class SentryDatabaseExecutor
   Future<int> rawDelete(String sql, [List<Object?>? arguments]) {
     return Future<int>(() async {
       final parent = _getParent();
+      final aggregated = _aggregate(
+        parent,
+        sql: sql,
+        operation: SentryDatabase.dbSqlExecuteOp,
+        execute: () => _executor.rawDelete(sql, arguments),
+        rowsOf: (rows) => rows,
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -422,6 +537,16 @@ class SentryDatabaseExecutor
   Future<int> rawInsert(String sql, [List<Object?>? arguments]) {
     return Future<int>(() async {
       final parent = _getParent();
+      final aggregated = _aggregate(
+        parent,
+        sql: sql,
+        operation: SentryDatabase.dbSqlExecuteOp,
+        execute: () => _executor.rawInsert(sql, arguments),
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -470,6 +595,17 @@ class SentryDatabaseExecutor
   ]) {
     return Future<List<Map<String, Object?>>>(() async {
       final parent = _getParent();
+      final aggregated = _aggregate(
+        parent,
+        sql: sql,
+        operation: SentryDatabase.dbSqlQueryOp,
+        execute: () => _executor.rawQuery(sql, arguments),
+        rowsOf: (rows) => rows.length,
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -519,6 +655,20 @@ class SentryDatabaseExecutor
   }) {
     return Future<QueryCursor>(() async {
       final parent = _getParent();
+      final aggregated = _aggregate(
+        parent,
+        sql: sql,
+        operation: SentryDatabase.dbSqlQueryOp,
+        execute: () => _executor.rawQueryCursor(
+          sql,
+          arguments,
+          bufferSize: bufferSize,
+        ),
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -568,6 +718,17 @@ class SentryDatabaseExecutor
   Future<int> rawUpdate(String sql, [List<Object?>? arguments]) {
     return Future<int>(() async {
       final parent = _getParent();
+      final aggregated = _aggregate(
+        parent,
+        sql: sql,
+        operation: SentryDatabase.dbSqlExecuteOp,
+        execute: () => _executor.rawUpdate(sql, arguments),
+        rowsOf: (rows) => rows,
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -626,6 +787,23 @@ class SentryDatabaseExecutor
         whereArgs: whereArgs,
         conflictAlgorithm: conflictAlgorithm,
       );
+      final aggregated = _aggregate(
+        parent,
+        sql: builder.sql,
+        operation: SentryDatabase.dbSqlExecuteOp,
+        execute: () => _executor.update(
+          table,
+          values,
+          where: where,
+          whereArgs: whereArgs,
+          conflictAlgorithm: conflictAlgorithm,
+        ),
+        rowsOf: (rows) => rows,
+      );
+      if (aggregated != null) {
+        return aggregated;
+      }
+
       final span = parent != null
           ? _spanFactory.createSpan(
               parentSpan: parent,
@@ -0,0 +1,82 @@
+// ignore_for_file: invalid_use_of_internal_member
+
+import 'package:sentry/sentry.dart';
+
+import '../sentry_batch.dart';
+import '../sentry_database.dart';
+import '../sentry_database_executor.dart';
+import 'sentry_database_span_attributes.dart';
+
+/// Runs [execute] and counts the statement [sql] in the summary span of its
+/// fingerprint instead of creating a span and a breadcrumb for it, see
+/// [SentryOptions.operationAggregation].
+///
+/// Returns `null` without running [execute] if aggregation is disabled.
+/// Statements that fail or are outliers are still reported with a span and a
+/// breadcrumb of their own. [rowsOf] returns the number of rows returned or
+/// affected by the statement.
+Future<T>? aggregateQuery<T>(
+  Hub hub,
+  InstrumentationSpan? parentSpan, {
+  required String sql,
+  required String operation,
+  required String origin,
+  required String? dbName,
+  required Future<T> Function() execute,
+  int? Function(T result)? rowsOf,
+}) {
+  final aggregator = _aggregator(hub, operation, origin);
+  if (aggregator == null) {
+    return null;
+  }
+  return aggregator.run(
+    parentSpan,
+    group: dbName ?? SentryDatabase.dbSystem,
+    name: SqlFingerprinter.shared.fingerprint(sql),
+    description: sql,
+    origin: origin,
+    execute: execute,
+    rowsOf: rowsOf,
+    setSpanData: (span) => setDatabaseAttributeData(span, dbName),
+    breadcrumb: () {
+      final breadcrumb = Breadcrumb(
+        message: sql,
+        category: operation,
+        data: {},
+        type: 'query',
+      );
+      setDatabaseAttributeOnBreadcrumb(breadcrumb, dbName);
+      return breadcrumb;
+    },
+  );
+}
+
+/// Finishes the summary spans of the statements run by
+/// [SentryDatabaseExecutor] and of the batches run by [SentryBatch], so that
+/// they end before the database transaction span they belong to.
+void flushQueryAggregation(Hub hub) {
+  for (final operation in [
+    SentryDatabase.dbSqlQueryOp,
+    SentryDatabase.dbSqlExecuteOp,
+  ]) {
+    _aggregator(
+      hub,
+      operation,
+      SentryTraceOrigins.autoDbSqfliteDatabaseExecutor,
+    )?.flush();
+  }
+  _aggregator(
+    hub,
+    SentryDatabase.dbOp,
+    SentryTraceOrigins.autoDbSqfliteBatch,
+  )?.flush();
+}
+
+OperationAggregator? _aggregator(Hub hub, String operation, String origin) =>
+    OperationAggregator.of(
+      hub,
+      operation: operation,
+      system: SentryDatabase.dbSystem,
+      origin: origin,
+      spanPerName: true,
+    );
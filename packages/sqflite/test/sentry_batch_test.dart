@@ -586,6 +586,28 @@ SELECT * FROM Product''';
       await db.close();
     });
 
+    test('finishes the aggregated batch span with the db transaction',
+        () async {
+      fixture.options.operationAggregation = SentryOperationAggregation();
+      final db = await fixture.getDatabase();
+
+      await db.transaction((txn) async {
+        final batch = txn.batch();
+        batch.insert('Product', <String, Object?>{'title': 'Product 1'});
+        await batch.commit();
+      });
+
+      final span = fixture.tracer.children.singleWhere(
+        // ignore: invalid_use_of_internal_member
+        (span) => span.origin == SentryTraceOrigins.autoDbSqfliteBatch,
+      );
+      expect(span.context.operation, SentryDatabase.dbOp);
+      expect(span.finished, isTrue);
+      expect(span.data['db.aggregate.count'], 1);
+
+      await db.close();
+    });
+
     tearDown(() {
       databaseFactory = sqfliteDatabaseFactoryDefault;
     });